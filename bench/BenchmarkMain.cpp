@@ -0,0 +1,42 @@
+// ================================================================================================
+// File: BenchmarkMain.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Entry point of tetris-bench. Runs the benchmarks like the usual Google Benchmark main,
+//              but unless an output file is given with --benchmark_out, the results are also written
+//              as JSON to tetris-bench.json, so every run leaves a file that can be compared between
+//              releases (e.g. with compare.py from Google Benchmark).
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <benchmark/benchmark.h>
+#include <string_view>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+	static char defaultOutput[] = "--benchmark_out=tetris-bench.json";
+	static char defaultOutputFormat[] = "--benchmark_out_format=json";
+
+	std::vector<char*> arguments(argv, argv + argc);
+	bool hasOutput = false;
+	for (int i = 1; i < argc; ++i)
+		hasOutput |= std::string_view(argv[i]).substr(0, 16) == "--benchmark_out=";
+	if (!hasOutput)
+	{
+		arguments.push_back(defaultOutput);
+		arguments.push_back(defaultOutputFormat);
+	}
+
+	int argumentCount = static_cast<int>(arguments.size());
+	arguments.push_back(nullptr);
+	benchmark::Initialize(&argumentCount, arguments.data());
+	if (benchmark::ReportUnrecognizedArguments(argumentCount, arguments.data()))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,316 @@
+// ================================================================================================
+// File: EngineBenchmark.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Micro-benchmarks of the engine hot paths: collision tests, moves and rotations,
+//              filled line detection and line clears, tetromino generation, a simulation tick,
+//              storing a tick in the rewind buffer and the bot's search. The boards and
+//              tetrominoes are sampled from seeded games, one played by the bot (low, clean
+//              stacks) and some played with random input (tall, ragged stacks), so the cases are
+//              realistic and the same on every run.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <vector>
+#include "Core/AutoPlayer.hpp"
+#include "Core/Replay.hpp"
+#include "Core/RewindBuffer.hpp"
+
+namespace
+{
+	constexpr std::uint32_t SEED = 12345u;
+	constexpr unsigned BOT_PIECES = 1000u;
+	constexpr unsigned RANDOM_GAMES = 40u;
+	constexpr unsigned SAMPLE_INTERVAL = 7u; // Ticks between sampled positions
+	constexpr size_t CLEAR_BATCH_SIZE = 256u; // Boards cleared per timed batch
+
+	// A board with a falling tetromino on it
+	struct Position
+	{
+		Grid grid;
+		Tetromino tetromino;
+	};
+
+	void samplePositions(Simulation& simulation, std::vector<Position>& positions, unsigned ticks)
+	{
+		if (ticks % SAMPLE_INTERVAL == 0u && !simulation.isGameOver())
+			positions.push_back({ simulation.getGrid(), simulation.getCurrentTetromino() });
+	}
+
+	const std::vector<Position>& getPositions()
+	{
+		static const std::vector<Position> positions = []()
+			{
+				std::vector<Position> positions;
+
+				Simulation simulation(SEED);
+				AutoPlayer autoPlayer;
+				for (unsigned ticks = 0, pieces = 0; pieces < BOT_PIECES && !simulation.isGameOver(); ++ticks)
+				{
+					simulation.step(autoPlayer.update(simulation));
+					pieces += simulation.hasEvent(Simulation::TETROMINO_LOCKED);
+					samplePositions(simulation, positions, ticks);
+				}
+
+				Xoshiro128 rng(SEED);
+				for (unsigned game = 0; game < RANDOM_GAMES; ++game)
+				{
+					simulation.reset(SEED + game + 1u);
+					for (unsigned ticks = 0; !simulation.isGameOver(); ++ticks)
+					{
+						Simulation::Input input;
+						const bool isLeft = rng.nextBelow(4u) == 0u;
+						const bool isRight = rng.nextBelow(4u) == 0u;
+						input.shift = static_cast<std::int8_t>(isRight - isLeft);
+						input.rotateCW = rng.nextBelow(8u) == 0u;
+						simulation.step(input);
+						samplePositions(simulation, positions, ticks);
+					}
+				}
+				return positions;
+			}();
+		return positions;
+	}
+
+	// Boards with exactly `lineCount` filled lines at the bottom of their stack
+	std::vector<Grid> getBoardsWithFilledLines(unsigned lineCount)
+	{
+		std::vector<Grid> boards;
+		for (const Position& position : getPositions())
+		{
+			if (!position.grid.getFilledLines().empty())
+				continue;
+
+			Grid grid = position.grid;
+			for (int y = Grid::HEIGHT - 1; y >= static_cast<int>(Grid::HEIGHT - lineCount); --y)
+				for (int x = 0; x < static_cast<int>(Grid::WIDTH); ++x)
+					grid.fillCell({ x, y }, Tetromino::Type::T);
+			boards.push_back(std::move(grid));
+		}
+		return boards;
+	}
+
+	void BM_IsAtValidPosition(benchmark::State& state)
+	{
+		const std::vector<Position>& positions = getPositions();
+		size_t i = 0u;
+		for (auto _ : state)
+		{
+			const Position& position = positions[i];
+			benchmark::DoNotOptimize(position.tetromino.isAtValidPosition(position.grid));
+			i = i + 1u == positions.size() ? 0u : i + 1u;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_IsAtValidPosition);
+
+	void BM_TryMove(benchmark::State& state)
+	{
+		const std::vector<Position>& positions = getPositions();
+		const Vector2i offset{ static_cast<int>(state.range(0)), static_cast<int>(state.range(1)) };
+		size_t i = 0u;
+		for (auto _ : state)
+		{
+			Tetromino tetromino = positions[i].tetromino;
+			benchmark::DoNotOptimize(tetromino.tryMove(offset, positions[i].grid));
+			benchmark::DoNotOptimize(tetromino);
+			i = i + 1u == positions.size() ? 0u : i + 1u;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_TryMove)->ArgNames({ "dx", "dy" })->Args({ -1, 0 })->Args({ 1, 0 })->Args({ 0, 1 });
+
+	// Landing row from the column heights, compared with probing one row at a time like the gravity
+	// used to before hard drop and 20G
+	void BM_GetDropDistance(benchmark::State& state)
+	{
+		const std::vector<Position>& positions = getPositions();
+		const bool isProbing = state.range(0) != 0;
+		size_t i = 0u;
+		for (auto _ : state)
+		{
+			const Position& position = positions[i];
+			int distance = 0;
+			if (isProbing)
+			{
+				while (!position.grid.doesCollide(position.tetromino.getRowMasks(), position.tetromino.position + Vector2i{ 0, distance + 1 }))
+					++distance;
+			}
+			else
+				distance = position.grid.getDropDistance(position.tetromino);
+			benchmark::DoNotOptimize(distance);
+			i = i + 1u == positions.size() ? 0u : i + 1u;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_GetDropDistance)->ArgName("probing")->Arg(0)->Arg(1);
+
+	void BM_TryRotate(benchmark::State& state)
+	{
+		const std::vector<Position>& positions = getPositions();
+		const auto direction = static_cast<Tetromino::RotationDirection>(state.range(0));
+		size_t i = 0u;
+		for (auto _ : state)
+		{
+			Tetromino tetromino = positions[i].tetromino;
+			benchmark::DoNotOptimize(tetromino.tryRotate(direction, positions[i].grid));
+			benchmark::DoNotOptimize(tetromino);
+			i = i + 1u == positions.size() ? 0u : i + 1u;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_TryRotate)
+		->ArgName("direction")
+		->Arg(static_cast<int>(Tetromino::RotationDirection::Clockwise))
+		->Arg(static_cast<int>(Tetromino::RotationDirection::CounterClockwise))
+		->Arg(static_cast<int>(Tetromino::RotationDirection::Half));
+
+	void BM_GetFilledLines(benchmark::State& state)
+	{
+		const std::vector<Grid> boards = getBoardsWithFilledLines(static_cast<unsigned>(state.range(0)));
+		size_t i = 0u;
+		for (auto _ : state)
+		{
+			benchmark::DoNotOptimize(boards[i].getFilledLines());
+			i = i + 1u == boards.size() ? 0u : i + 1u;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_GetFilledLines)->ArgName("lines")->DenseRange(0, 4);
+
+	void BM_ClearFilledLines(benchmark::State& state)
+	{
+		const std::vector<Grid> boards = getBoardsWithFilledLines(static_cast<unsigned>(state.range(0)));
+		const std::vector<unsigned> filledLines = boards.front().getFilledLines();
+		std::vector<Grid> batch;
+		size_t next = 0u;
+
+		for (auto _ : state)
+		{
+			// Clearing changes the board, so every batch is cleared from fresh copies
+			state.PauseTiming();
+			batch.clear();
+			for (size_t i = 0; i < CLEAR_BATCH_SIZE; ++i)
+			{
+				batch.push_back(boards[next]);
+				next = next + 1u == boards.size() ? 0u : next + 1u;
+			}
+			state.ResumeTiming();
+
+			for (Grid& grid : batch)
+				grid.clearFilledLinesAndPushDown(filledLines);
+			benchmark::ClobberMemory();
+		}
+		state.SetItemsProcessed(state.iterations() * CLEAR_BATCH_SIZE);
+	}
+	BENCHMARK(BM_ClearFilledLines)->ArgName("lines")->DenseRange(1, 4);
+
+	template <class Randomizer>
+	void BM_GeneratorGetNext(benchmark::State& state)
+	{
+		BasicTetrominoGenerator<Randomizer> generator(SEED);
+		for (auto _ : state)
+			benchmark::DoNotOptimize(generator.getNext());
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK_TEMPLATE(BM_GeneratorGetNext, SevenBagRandomizer);
+	BENCHMARK_TEMPLATE(BM_GeneratorGetNext, FourteenBagRandomizer);
+	BENCHMARK_TEMPLATE(BM_GeneratorGetNext, HistoryRandomizer);
+	BENCHMARK_TEMPLATE(BM_GeneratorGetNext, PureRandomizer);
+
+	// A single simulation tick, with the input of a recorded bot game so the ticks cover movement,
+	// rotations, locks and line clears in realistic proportions
+	void BM_SimulationStep(benchmark::State& state)
+	{
+		static const Replay replay = []()
+			{
+				Replay replay;
+				replay.start(SEED);
+				Simulation simulation(SEED);
+				AutoPlayer autoPlayer;
+				for (unsigned pieces = 0; pieces < BOT_PIECES && !simulation.isGameOver();)
+				{
+					const Simulation::Input input = autoPlayer.update(simulation);
+					replay.record(input);
+					simulation.step(input);
+					pieces += simulation.hasEvent(Simulation::TETROMINO_LOCKED);
+				}
+				return replay;
+			}();
+
+		Simulation simulation(replay.getSeed());
+		Replay::Player player(replay);
+		for (auto _ : state)
+		{
+			if (player.isFinished())
+			{
+				state.PauseTiming();
+				simulation.reset(replay.getSeed());
+				player = Replay::Player(replay);
+				state.ResumeTiming();
+			}
+			simulation.step(player.next());
+			benchmark::DoNotOptimize(simulation.getEvents());
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_SimulationStep);
+
+	// Capture and delta encoding of the state after a tick of a game played by the bot, with the
+	// average size of a stored state once the buffer is full
+	void BM_RewindBufferPush(benchmark::State& state)
+	{
+		std::vector<Simulation> simulations;
+		Simulation simulation(SEED);
+		AutoPlayer autoPlayer;
+		for (unsigned ticks = 0; ticks < 4u * RewindBuffer::CAPACITY && !simulation.isGameOver(); ++ticks)
+		{
+			simulation.step(autoPlayer.update(simulation));
+			simulations.push_back(simulation);
+		}
+
+		RewindBuffer rewindBuffer;
+		size_t i = 0u;
+		for (auto _ : state)
+		{
+			rewindBuffer.push(simulations[i]);
+			i = i + 1u == simulations.size() ? 0u : i + 1u;
+		}
+		state.SetItemsProcessed(state.iterations());
+		state.counters["bytes_per_state"] = static_cast<double>(rewindBuffer.getMemoryUsage()) / static_cast<double>(std::max<size_t>(rewindBuffer.getSize(), 1u));
+		state.counters["buffer_bytes"] = static_cast<double>(rewindBuffer.getMemoryUsage());
+	}
+	BENCHMARK(BM_RewindBufferPush);
+
+	// Full search of the bot for a new tetromino, with the next tetromino as lookahead
+	void BM_AutoPlayerSearch(benchmark::State& state)
+	{
+		std::vector<Simulation> simulations;
+		Simulation simulation(SEED);
+		AutoPlayer autoPlayer;
+		for (unsigned pieces = 0; pieces < 64u && !simulation.isGameOver();)
+		{
+			simulation.step(autoPlayer.update(simulation));
+			if (simulation.hasEvent(Simulation::TETROMINO_LOCKED))
+			{
+				simulations.push_back(simulation);
+				++pieces;
+			}
+		}
+
+		size_t i = 0u;
+		for (auto _ : state)
+		{
+			// A reset bot always starts a new search
+			autoPlayer.reset();
+			benchmark::DoNotOptimize(autoPlayer.update(simulations[i]));
+			i = i + 1u == simulations.size() ? 0u : i + 1u;
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_AutoPlayerSearch)->Unit(benchmark::kMicrosecond);
+}
\ No newline at end of file
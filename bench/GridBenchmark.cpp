@@ -0,0 +1,272 @@
+// ================================================================================================
+// File: GridBenchmark.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Micro-benchmark comparing the bitboard Grid against the previous per-cell grid
+//              (a vector of rows of cells, with collision tests done one cell at a time) on the hot
+//              paths: collision tests, filled line detection and line clears. The previous
+//              implementation is reproduced here without its SFML drawables, so the measured
+//              speedup is a lower bound.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "Core/Grid.hpp"
+
+namespace
+{
+	// The grid as it was stored before the row masks were introduced
+	class LegacyGrid
+	{
+	public:
+		struct Cell
+		{
+			Tetromino::Type type = Tetromino::Type::I;
+			bool isFilled = false;
+		};
+
+		LegacyGrid() : cells(Grid::HEIGHT, std::vector<Cell>(Grid::WIDTH)) {}
+
+		void fillCell(Vector2i position)
+		{
+			if (position.x >= 0 && position.x < static_cast<int>(Grid::WIDTH) &&
+				position.y >= 0 && position.y < static_cast<int>(Grid::HEIGHT))
+				cells[position.y][position.x].isFilled = true;
+		}
+
+		bool isCellFilled(Vector2i position) const
+		{
+			if (position.x >= 0 && position.x < static_cast<int>(Grid::WIDTH) &&
+				position.y >= 0 && position.y < static_cast<int>(Grid::HEIGHT))
+				return cells[position.y][position.x].isFilled;
+			return false;
+		}
+
+		bool isAtValidPosition(const Tetromino::Shape& shape, Vector2i position) const
+		{
+			for (int y = 0; y < 4; ++y)
+			{
+				for (int x = 0; x < 4; ++x)
+				{
+					if (shape[y][x])
+					{
+						int gridX = position.x + x;
+						int gridY = position.y + y;
+						if (gridX < 0 || gridX >= static_cast<int>(Grid::WIDTH) || gridY < 0 || gridY >= static_cast<int>(Grid::HEIGHT))
+							return false;
+						if (isCellFilled({ gridX, gridY }))
+							return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		std::vector<unsigned> getFilledLines() const
+		{
+			std::vector<unsigned> filledLines;
+			for (unsigned y = 0; y < Grid::HEIGHT; ++y)
+			{
+				bool isFilled = true;
+				for (unsigned x = 0; x < Grid::WIDTH; ++x)
+				{
+					if (!cells[y][x].isFilled)
+					{
+						isFilled = false;
+						break;
+					}
+				}
+				if (isFilled)
+					filledLines.push_back(y);
+			}
+			return filledLines;
+		}
+
+		void clearFilledLinesAndPushDown(const std::vector<unsigned>& filledLines)
+		{
+			for (const auto& line : filledLines)
+			{
+				for (unsigned x = 0; x < Grid::WIDTH; ++x)
+					cells[line][x].isFilled = false;
+
+				for (int y = line - 1; y >= 0; --y)
+				{
+					for (unsigned x = 0; x < Grid::WIDTH; ++x)
+					{
+						if (cells[y][x].isFilled)
+						{
+							cells[size_t(y + 1)][x] = cells[y][x];
+							cells[y][x].isFilled = false;
+						}
+					}
+				}
+			}
+		}
+
+	private:
+		std::vector<std::vector<Cell>> cells;
+	};
+
+	struct Orientation
+	{
+		Tetromino::Shape shape;
+		Tetromino::RowMasks masks;
+	};
+
+	// Every distinct orientation of every tetromino
+	std::vector<Orientation> getOrientations()
+	{
+		std::vector<Orientation> orientations;
+		const Grid emptyGrid;
+		for (unsigned type = 0; type < Tetromino::TYPE_COUNT; ++type)
+		{
+			Tetromino tetromino(static_cast<Tetromino::Type>(type));
+			tetromino.position = { 3, 5 };
+			for (unsigned rotation = 0; rotation < 4; ++rotation)
+			{
+				Tetromino::Shape shape{};
+				for (const auto& cell : tetromino.getCells())
+					shape[cell.y][cell.x] = true;
+				orientations.push_back({ shape, tetromino.getRowMasks() });
+				tetromino.tryRotate(Tetromino::RotationDirection::Clockwise, emptyGrid);
+			}
+		}
+		return orientations;
+	}
+
+	// Fill the bottom of both grids with a random stack, leaving one hole per row unless the row
+	// is one of the `fullLines` bottom rows
+	void buildBoard(std::mt19937& rng, Grid& grid, LegacyGrid& legacyGrid, unsigned fullLines)
+	{
+		std::uniform_int_distribution<int> heightDistribution(4, 12);
+		std::uniform_int_distribution<int> columnDistribution(0, Grid::WIDTH - 1);
+		std::bernoulli_distribution fillDistribution(0.7);
+
+		const int stackHeight = heightDistribution(rng);
+		for (int y = Grid::HEIGHT - 1; y >= static_cast<int>(Grid::HEIGHT) - stackHeight; --y)
+		{
+			const bool isFull = y >= static_cast<int>(Grid::HEIGHT - fullLines);
+			const int hole = columnDistribution(rng);
+			for (int x = 0; x < static_cast<int>(Grid::WIDTH); ++x)
+			{
+				if (isFull || (x != hole && fillDistribution(rng)))
+				{
+					grid.fillCell({ x, y }, Tetromino::Type::T);
+					legacyGrid.fillCell({ x, y });
+				}
+			}
+		}
+	}
+
+	template<typename Function>
+	double measureNanoseconds(Function&& function, double operations)
+	{
+		auto start = std::chrono::steady_clock::now();
+		function();
+		auto end = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(end - start).count() / operations;
+	}
+
+	void report(const char* name, double legacyNanoseconds, double bitboardNanoseconds)
+	{
+		std::printf("%-34s %10.2f ns %10.2f ns %8.1fx\n", name, legacyNanoseconds, bitboardNanoseconds, legacyNanoseconds / bitboardNanoseconds);
+	}
+}
+
+int main()
+{
+	constexpr unsigned BOARD_COUNT = 2000u;
+	constexpr unsigned REPETITIONS = 20u;
+
+	std::mt19937 rng(12345u);
+	const std::vector<Orientation> orientations = getOrientations();
+
+	std::vector<Grid> grids(BOARD_COUNT);
+	std::vector<LegacyGrid> legacyGrids(BOARD_COUNT);
+	for (unsigned i = 0; i < BOARD_COUNT; ++i)
+		buildBoard(rng, grids[i], legacyGrids[i], 1u + i % 4u);
+
+	std::printf("%-34s %13s %13s %9s\n", "", "per-cell", "bitboard", "speedup");
+
+	// Collision tests for every orientation at every position in and around the grid
+	{
+		const double tests = double(BOARD_COUNT) * REPETITIONS * orientations.size() * 14 * 24;
+		unsigned legacyValid = 0u, bitboardValid = 0u;
+
+		double legacy = measureNanoseconds([&]()
+			{
+				for (unsigned r = 0; r < REPETITIONS; ++r)
+					for (const auto& grid : legacyGrids)
+						for (const auto& orientation : orientations)
+							for (int y = -3; y < 21; ++y)
+								for (int x = -3; x < 11; ++x)
+									legacyValid += grid.isAtValidPosition(orientation.shape, { x, y });
+			}, tests);
+
+		double bitboard = measureNanoseconds([&]()
+			{
+				for (unsigned r = 0; r < REPETITIONS; ++r)
+					for (const auto& grid : grids)
+						for (const auto& orientation : orientations)
+							for (int y = -3; y < 21; ++y)
+								for (int x = -3; x < 11; ++x)
+									bitboardValid += !grid.doesCollide(orientation.masks, { x, y });
+			}, tests);
+
+		if (legacyValid != bitboardValid)
+			std::printf("Mismatch: %u valid positions (per-cell) vs %u (bitboard)\n", legacyValid, bitboardValid);
+		report("collision test", legacy, bitboard);
+	}
+
+	// Filled line detection
+	{
+		const double calls = double(BOARD_COUNT) * REPETITIONS;
+		size_t legacyLines = 0u, bitboardLines = 0u;
+
+		double legacy = measureNanoseconds([&]()
+			{
+				for (unsigned r = 0; r < REPETITIONS; ++r)
+					for (const auto& grid : legacyGrids)
+						legacyLines += grid.getFilledLines().size();
+			}, calls);
+
+		double bitboard = measureNanoseconds([&]()
+			{
+				for (unsigned r = 0; r < REPETITIONS; ++r)
+					for (const auto& grid : grids)
+						bitboardLines += grid.getFilledLines().size();
+			}, calls);
+
+		if (legacyLines != bitboardLines)
+			std::printf("Mismatch: %zu filled lines (per-cell) vs %zu (bitboard)\n", legacyLines, bitboardLines);
+		report("getFilledLines", legacy, bitboard);
+	}
+
+	// Line clears (1-4 lines), each board is cleared once
+	{
+		std::vector<std::vector<unsigned>> filledLines(BOARD_COUNT);
+		for (unsigned i = 0; i < BOARD_COUNT; ++i)
+			filledLines[i] = grids[i].getFilledLines();
+
+		double legacy = measureNanoseconds([&]()
+			{
+				for (unsigned i = 0; i < BOARD_COUNT; ++i)
+					legacyGrids[i].clearFilledLinesAndPushDown(filledLines[i]);
+			}, BOARD_COUNT);
+
+		double bitboard = measureNanoseconds([&]()
+			{
+				for (unsigned i = 0; i < BOARD_COUNT; ++i)
+					grids[i].clearFilledLinesAndPushDown(filledLines[i]);
+			}, BOARD_COUNT);
+
+		report("clearFilledLinesAndPushDown", legacy, bitboard);
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+// ================================================================================================
+// File: RenderBenchmark.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Benchmarks of the per-tick work of the game outside the rules: the in-game part of a
+//              Game::update tick (simulation step, board and HUD updates) and rendering the in-game
+//              scene offscreen into an sf::RenderTexture the size of the window. The Game class
+//              itself needs a window, audio and input, so the benchmarks drive the same components
+//              it owns. Frame times are the CPU cost of building and submitting a frame; the GPU
+//              runs asynchronously and isn't waited for.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <benchmark/benchmark.h>
+#include <optional>
+#include "Core/AutoPlayer.hpp"
+#include "Core/Replay.hpp"
+#include "BoardRenderer.hpp"
+#include "HUD.hpp"
+#include "Game.hpp"
+
+namespace
+{
+	constexpr std::uint32_t SEED = 54321u;
+	constexpr unsigned RECORDED_PIECES = 500u;
+	const sf::Color BACKGROUND_COLOR(17, 17, 18);
+
+	// Input of a bot game, so the ticks include moves, locks and line clears
+	const Replay& getReplay()
+	{
+		static const Replay replay = []()
+			{
+				Replay replay;
+				replay.start(SEED);
+				Simulation simulation(SEED);
+				AutoPlayer autoPlayer;
+				for (unsigned pieces = 0; pieces < RECORDED_PIECES && !simulation.isGameOver();)
+				{
+					const Simulation::Input input = autoPlayer.update(simulation);
+					replay.record(input);
+					simulation.step(input);
+					pieces += simulation.hasEvent(Simulation::TETROMINO_LOCKED);
+				}
+				return replay;
+			}();
+		return replay;
+	}
+
+	// Components of the in-game scene, kept up to date the same way Game does it
+	struct Scene
+	{
+		Scene() :
+			hud(font)
+		{
+			boardRenderer.setLayout({ Game::WINDOW_WIDTH, Game::WINDOW_HEIGHT }, BACKGROUND_COLOR);
+			boardRenderer.update(simulation);
+		}
+
+		void tick()
+		{
+			if (player.isFinished())
+			{
+				simulation.reset(getReplay().getSeed());
+				player = Replay::Player(getReplay());
+			}
+
+			simulation.step(player.next());
+			boardRenderer.update(simulation);
+			if (simulation.hasEvent(Simulation::LINES_CLEARED))
+			{
+				hud.updateScore(simulation.getScore());
+				hud.updateLevel(simulation.getLevel());
+				hud.updateLinesCleared(simulation.getTotalLinesCleared());
+			}
+		}
+
+		sf::Font font{ "assets/fonts/seguisb.ttf" };
+		Simulation simulation{ getReplay().getSeed() };
+		Replay::Player player{ getReplay() };
+		BoardRenderer boardRenderer;
+		HUD hud;
+	};
+
+	void BM_GameTick(benchmark::State& state)
+	{
+		// The vertex buffers are uploaded on update, which needs an OpenGL context
+		std::optional<sf::RenderTexture> target;
+		std::optional<Scene> scene;
+		try
+		{
+			target.emplace(sf::Vector2u(1u, 1u));
+			scene.emplace();
+		}
+		catch (const sf::Exception& exception)
+		{
+			state.SkipWithError(exception.what());
+			return;
+		}
+
+		for (auto _ : state)
+			scene->tick();
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_GameTick);
+
+	void BM_RenderFrame(benchmark::State& state)
+	{
+		sf::ContextSettings settings;
+		settings.antiAliasingLevel = static_cast<unsigned>(state.range(0));
+		std::optional<sf::RenderTexture> target;
+		std::optional<Scene> scene;
+		try
+		{
+			target.emplace(sf::Vector2u(Game::WINDOW_WIDTH, Game::WINDOW_HEIGHT), settings);
+			scene.emplace();
+		}
+		catch (const sf::Exception& exception)
+		{
+			state.SkipWithError(exception.what());
+			return;
+		}
+
+		// Every frame shows the next tick like in the game, but only drawing the frame is timed
+		for (auto _ : state)
+		{
+			state.PauseTiming();
+			scene->tick();
+			state.ResumeTiming();
+
+			target->clear(BACKGROUND_COLOR);
+			target->draw(scene->boardRenderer);
+			target->draw(scene->hud);
+			target->display();
+		}
+		state.SetItemsProcessed(state.iterations());
+	}
+	BENCHMARK(BM_RenderFrame)->ArgName("antialiasing")->Arg(0)->Arg(8)->Unit(benchmark::kMicrosecond);
+}
\ No newline at end of file
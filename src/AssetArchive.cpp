@@ -0,0 +1,232 @@
+// ================================================================================================
+// File: AssetArchive.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include "AssetArchive.hpp"
+
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#ifdef __APPLE__
+		#include <mach-o/dyld.h>
+	#endif
+#endif
+
+namespace
+{
+	constexpr size_t HEADER_SIZE = sizeof(AssetArchive::MAGIC) + 1u + 4u;
+	constexpr size_t ENTRY_SIZE = 2u + 8u + 8u; // Without the name
+
+	void writeUint(std::vector<std::uint8_t>& data, std::uint64_t value, unsigned size)
+	{
+		for (unsigned i = 0; i < size; ++i)
+			data.push_back(static_cast<std::uint8_t>(value >> (8u * i)));
+	}
+
+	std::uint64_t readUint(const std::uint8_t* data, unsigned size)
+	{
+		std::uint64_t value = 0u;
+		for (unsigned i = 0; i < size; ++i)
+			value |= static_cast<std::uint64_t>(data[i]) << (8u * i);
+		return value;
+	}
+
+	size_t align(size_t offset)
+	{
+		return (offset + AssetArchive::DATA_ALIGNMENT - 1u) / AssetArchive::DATA_ALIGNMENT * AssetArchive::DATA_ALIGNMENT;
+	}
+}
+
+bool AssetArchive::open(const std::filesystem::path& path)
+{
+	close();
+
+#ifdef _WIN32
+	const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file != INVALID_HANDLE_VALUE)
+	{
+		LARGE_INTEGER size;
+		if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+		{
+			fileMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (fileMapping)
+			{
+				mapping = static_cast<const std::uint8_t*>(MapViewOfFile(fileMapping, FILE_MAP_READ, 0, 0, 0));
+				mappingSize = static_cast<size_t>(size.QuadPart);
+			}
+		}
+		// The mapping keeps the file open
+		CloseHandle(file);
+	}
+#else
+	const int file = ::open(path.c_str(), O_RDONLY);
+	if (file >= 0)
+	{
+		struct stat status;
+		if (fstat(file, &status) == 0 && status.st_size > 0)
+		{
+			void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+			if (view != MAP_FAILED)
+			{
+				mapping = static_cast<const std::uint8_t*>(view);
+				mappingSize = static_cast<size_t>(status.st_size);
+			}
+		}
+		// The mapping keeps the file open
+		::close(file);
+	}
+#endif
+
+	if (!mapping)
+	{
+		std::cerr << "Error: Failed to open the asset archive " << path.string() << "." << std::endl;
+		close();
+		return false;
+	}
+	if (!readIndex())
+	{
+		std::cerr << "Error: " << path.string() << " is not a valid asset archive." << std::endl;
+		close();
+		return false;
+	}
+	return true;
+}
+
+void AssetArchive::close()
+{
+	index.clear();
+#ifdef _WIN32
+	if (mapping)
+		UnmapViewOfFile(mapping);
+	if (fileMapping)
+		CloseHandle(fileMapping);
+	fileMapping = nullptr;
+#else
+	if (mapping)
+		munmap(const_cast<std::uint8_t*>(mapping), mappingSize);
+#endif
+	mapping = nullptr;
+	mappingSize = 0u;
+}
+
+AssetArchive::Asset AssetArchive::find(std::string_view name) const
+{
+	const auto it = index.find(name);
+	return it != index.end() ? it->second : Asset();
+}
+
+bool AssetArchive::pack(const std::filesystem::path& path, const std::vector<std::pair<std::string, std::filesystem::path>>& files)
+{
+	std::vector<std::vector<std::uint8_t>> contents;
+	contents.reserve(files.size());
+	size_t indexSize = HEADER_SIZE;
+	for (const auto& [name, file] : files)
+	{
+		std::ifstream stream(file, std::ios::binary);
+		contents.emplace_back((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+		if (!stream.good() && !stream.eof())
+		{
+			std::cerr << "Error: Failed to read " << file.string() << "." << std::endl;
+			return false;
+		}
+		indexSize += ENTRY_SIZE + name.size();
+	}
+
+	std::vector<std::uint8_t> data;
+	data.insert(data.end(), std::begin(MAGIC), std::end(MAGIC));
+	writeUint(data, FORMAT_VERSION, 1u);
+	writeUint(data, files.size(), 4u);
+
+	size_t offset = align(indexSize);
+	for (size_t i = 0; i < files.size(); ++i)
+	{
+		const std::string& name = files[i].first;
+		writeUint(data, name.size(), 2u);
+		data.insert(data.end(), name.begin(), name.end());
+		writeUint(data, offset, 8u);
+		writeUint(data, contents[i].size(), 8u);
+		offset = align(offset + contents[i].size());
+	}
+	for (const auto& content : contents)
+	{
+		data.resize(align(data.size()), 0u);
+		data.insert(data.end(), content.begin(), content.end());
+	}
+
+	std::ofstream stream(path, std::ios::binary);
+	if (!stream.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())))
+	{
+		std::cerr << "Error: Failed to write the asset archive " << path.string() << "." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+std::filesystem::path AssetArchive::getDefaultPath()
+{
+	std::filesystem::path executable;
+#if defined(_WIN32)
+	std::wstring buffer(MAX_PATH, L'\0');
+	DWORD length;
+	while ((length = GetModuleFileNameW(nullptr, buffer.data(), static_cast<DWORD>(buffer.size()))) == buffer.size())
+		buffer.resize(buffer.size() * 2u);
+	buffer.resize(length);
+	executable = buffer;
+#elif defined(__APPLE__)
+	std::uint32_t size = 0u;
+	_NSGetExecutablePath(nullptr, &size);
+	std::string buffer(size, '\0');
+	if (_NSGetExecutablePath(buffer.data(), &size) == 0)
+		executable = buffer.c_str();
+#else
+	std::error_code error;
+	executable = std::filesystem::read_symlink("/proc/self/exe", error);
+#endif
+
+	// Fall back to the working directory if the executable can't be found
+	if (executable.empty())
+		return FILE_NAME;
+	return executable.parent_path() / FILE_NAME;
+}
+
+bool AssetArchive::readIndex()
+{
+	if (mappingSize < HEADER_SIZE || !std::equal(std::begin(MAGIC), std::end(MAGIC), mapping) || mapping[sizeof(MAGIC)] != FORMAT_VERSION)
+		return false;
+
+	const size_t count = static_cast<size_t>(readUint(mapping + sizeof(MAGIC) + 1u, 4u));
+	size_t offset = HEADER_SIZE;
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (mappingSize - offset < 2u)
+			return false;
+		const size_t nameLength = static_cast<size_t>(readUint(mapping + offset, 2u));
+		if (mappingSize - offset < ENTRY_SIZE + nameLength)
+			return false;
+
+		const std::string_view name(reinterpret_cast<const char*>(mapping + offset + 2u), nameLength);
+		const std::uint64_t dataOffset = readUint(mapping + offset + 2u + nameLength, 8u);
+		const std::uint64_t dataSize = readUint(mapping + offset + 2u + nameLength + 8u, 8u);
+		if (dataOffset > mappingSize || dataSize > mappingSize - dataOffset)
+			return false;
+
+		index[name] = { mapping + dataOffset, static_cast<size_t>(dataSize) };
+		offset += ENTRY_SIZE + nameLength;
+	}
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+// ================================================================================================
+// File: AssetArchive.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the AssetArchive class, a single file that holds every asset of the game
+//              behind an index of their names. The archive is packed at build time by
+//              tetris-pack and placed next to the executable. At runtime it's opened once and
+//              memory-mapped read-only, so the assets are handed out as views of the mapping,
+//              without copying, for the memory APIs of sf::Font, sf::SoundBuffer and sf::Music,
+//              and pages are only read from disk when those first touch them. The views stay
+//              valid as long as the archive is open.
+//
+//              Layout, little-endian: "TPAK", the format version (1 byte), the entry count (4
+//              bytes), then for every entry its name length (2 bytes), name, offset and size (8
+//              bytes each), followed by the data of the entries, each aligned to DATA_ALIGNMENT.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class AssetArchive
+{
+public:
+	static constexpr char MAGIC[4] = { 'T', 'P', 'A', 'K' };
+	static constexpr std::uint8_t FORMAT_VERSION = 1u;
+	static constexpr size_t DATA_ALIGNMENT = 16u;
+	static constexpr const char* FILE_NAME = "assets.pak";
+
+	// View of an asset inside the mapping
+	struct Asset
+	{
+		const void* data = nullptr;
+		size_t size = 0u;
+	};
+
+	AssetArchive() = default;
+	explicit AssetArchive(const std::filesystem::path& path) { open(path); }
+	~AssetArchive() { close(); }
+	AssetArchive(const AssetArchive&) = delete;
+	AssetArchive& operator=(const AssetArchive&) = delete;
+
+	bool open(const std::filesystem::path& path);
+	void close();
+	bool isOpen() const { return mapping != nullptr; }
+
+	// The asset stored under `name`, e.g. "sounds/pause.wav", or an empty view if there is none
+	Asset find(std::string_view name) const;
+
+	// Write the files to an archive, each stored under the name it's paired with
+	static bool pack(const std::filesystem::path& path, const std::vector<std::pair<std::string, std::filesystem::path>>& files);
+	// The archive next to the executable, so the game finds it from any working directory
+	static std::filesystem::path getDefaultPath();
+
+private:
+	bool readIndex();
+
+	const std::uint8_t* mapping = nullptr;
+	size_t mappingSize = 0u;
+#ifdef _WIN32
+	void* fileMapping = nullptr;
+#endif
+	std::unordered_map<std::string_view, Asset> index; // Names point into the mapping
+};
\ No newline at end of file
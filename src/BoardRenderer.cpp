@@ -0,0 +1,231 @@
+// ================================================================================================
+// File: BoardRenderer.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include "BoardRenderer.hpp"
+
+BoardRenderer::BoardRenderer() :
+	staticLayer(sf::VertexBuffer::Usage::Static),
+	dynamicLayer(sf::VertexBuffer::Usage::Dynamic),
+	windowSize(0u, 0u),
+	backgroundColor(sf::Color::Black),
+	isLayoutChanged(true),
+	areTetrominoesDrawn(false),
+	canInterpolate(false)
+{
+	dynamicLayer.resize(DYNAMIC_VERTEX_COUNT);
+
+	for (unsigned y = 0; y < Grid::HEIGHT; ++y)
+	{
+		for (unsigned x = 0; x < Grid::WIDTH; ++x)
+		{
+			const sf::Vector2f position(static_cast<float>(x * CELL_SIZE + OFFSET.x), static_cast<float>(y * CELL_SIZE + OFFSET.y));
+			dynamicLayer.writeQuad(CELLS_OFFSET + (y * Grid::WIDTH + x) * VERTICES_PER_QUAD, position, { CELL_SIZE, CELL_SIZE }, EMPTY_COLOR);
+		}
+	}
+	cellColors.fill(EMPTY_COLOR);
+}
+
+void BoardRenderer::setLayout(sf::Vector2u windowSize, sf::Color backgroundColor)
+{
+	this->windowSize = windowSize;
+	this->backgroundColor = backgroundColor;
+	isLayoutChanged = true;
+}
+
+void BoardRenderer::State::capture(const Simulation& simulation)
+{
+	rows = simulation.getGrid().getRows();
+	types = simulation.getGrid().getTypes();
+	lineFlashPhase = simulation.getLineFlashPhase();
+	const std::vector<unsigned>& lines = simulation.getFilledLines();
+	filledLineCount = static_cast<std::uint8_t>(std::min(lines.size(), MAX_FILLED_LINES));
+	for (size_t i = 0; i < filledLineCount; ++i)
+		filledLines[i] = static_cast<std::uint8_t>(lines[i]);
+
+	// A tetromino that only moved since the previous capture slides between the two positions, one
+	// that was rotated or took the place of a locked one snaps to where it is now
+	const Tetromino& tetromino = simulation.getCurrentTetromino();
+	canInterpolate = isCaptured &&
+		tetromino.getType() == current.getType() &&
+		tetromino.getRotation() == current.getRotation() &&
+		!simulation.hasEvent(Simulation::TETROMINO_LOCKED);
+	previousPosition = current.position;
+
+	ghost = simulation.getGhostTetromino();
+	current = tetromino;
+	next = simulation.getNextTetromino();
+	isCaptured = true;
+}
+
+void BoardRenderer::update(const State& state)
+{
+	if (isLayoutChanged)
+	{
+		buildStaticGeometry();
+		isLayoutChanged = false;
+	}
+
+	// Cell colors are derived from the occupancy rows and the type plane of the grid
+	for (unsigned y = 0; y < Grid::HEIGHT; ++y)
+	{
+		for (unsigned x = 0; x < Grid::WIDTH; ++x)
+		{
+			const size_t index = y * Grid::WIDTH + x;
+			const bool isFilled = (state.rows[y] >> (x + Grid::WALL_WIDTH)) & 1u;
+			const sf::Color color = isFilled ? getColor(state.types[index]) : EMPTY_COLOR;
+			if (cellColors[index] != color)
+			{
+				cellColors[index] = color;
+				dynamicLayer.writeQuadColor(CELLS_OFFSET + index * VERTICES_PER_QUAD, color);
+			}
+		}
+	}
+
+	if (state.lineFlashPhase != Simulation::LineFlashPhase::None)
+	{
+		sf::Color flashColor = state.lineFlashPhase == Simulation::LineFlashPhase::Hidden ? sf::Color::Transparent : sf::Color::White;
+		for (size_t i = 0; i < state.filledLineCount; ++i)
+		{
+			for (unsigned x = 0; x < Grid::WIDTH; ++x)
+			{
+				const size_t index = state.filledLines[i] * Grid::WIDTH + x;
+				if (cellColors[index] != flashColor)
+				{
+					cellColors[index] = flashColor;
+					dynamicLayer.writeQuadColor(CELLS_OFFSET + index * VERTICES_PER_QUAD, flashColor);
+				}
+			}
+		}
+	}
+
+	const Tetromino& ghost = state.ghost;
+	if (!areTetrominoesDrawn || ghost != drawnGhostTetromino)
+	{
+		writeTetromino(GHOST_TETROMINO_OFFSET, ghost, sf::Vector2f(static_cast<float>(ghost.position.x), static_cast<float>(ghost.position.y)), GHOST_ALPHA);
+		drawnGhostTetromino = ghost;
+	}
+
+	// States can be skipped, so the position to slide from comes with the state rather than from
+	// the one drawn before
+	const Tetromino& current = state.current;
+	canInterpolate = areTetrominoesDrawn && state.canInterpolate;
+	previousCurrentPosition = sf::Vector2f(static_cast<float>(state.previousPosition.x), static_cast<float>(state.previousPosition.y));
+
+	if (!areTetrominoesDrawn || current != drawnCurrentTetromino)
+	{
+		drawnCurrentPosition = sf::Vector2f(static_cast<float>(current.position.x), static_cast<float>(current.position.y));
+		writeTetromino(CURRENT_TETROMINO_OFFSET, current, drawnCurrentPosition);
+		drawnCurrentTetromino = current;
+	}
+
+	const Tetromino& next = state.next;
+	if (!areTetrominoesDrawn || next != drawnNextTetromino)
+	{
+		writeTetromino(NEXT_TETROMINO_OFFSET, next, getNextTetrominoPosition(next.getType()));
+		drawnNextTetromino = next;
+	}
+	areTetrominoesDrawn = true;
+
+	dynamicLayer.upload();
+}
+
+void BoardRenderer::update(const Simulation& simulation)
+{
+	capturedState.capture(simulation);
+	update(capturedState);
+}
+
+void BoardRenderer::interpolate(float alpha)
+{
+	if (!areTetrominoesDrawn)
+		return;
+
+	const sf::Vector2f current(static_cast<float>(drawnCurrentTetromino.position.x), static_cast<float>(drawnCurrentTetromino.position.y));
+	const sf::Vector2f position = canInterpolate ? previousCurrentPosition + (current - previousCurrentPosition) * std::clamp(alpha, 0.f, 1.f) : current;
+	if (position != drawnCurrentPosition)
+	{
+		writeTetromino(CURRENT_TETROMINO_OFFSET, drawnCurrentTetromino, position);
+		drawnCurrentPosition = position;
+		dynamicLayer.upload();
+	}
+}
+
+void BoardRenderer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	staticLayer.draw(target, states, BACKGROUND_OFFSET, BACKGROUND_VERTEX_COUNT);
+	dynamicLayer.draw(target, states, CELLS_OFFSET, CELL_COUNT * VERTICES_PER_QUAD);
+	staticLayer.draw(target, states, GRID_OFFSET, GRID_VERTEX_COUNT);
+	dynamicLayer.draw(target, states, GHOST_TETROMINO_OFFSET, 3u * VERTICES_PER_TETROMINO);
+	// The top bar hides the part of the current tetromino that is above the grid
+	staticLayer.draw(target, states, FOREGROUND_OFFSET, FOREGROUND_VERTEX_COUNT);
+}
+
+void BoardRenderer::buildStaticGeometry()
+{
+	staticLayer.resize(STATIC_VERTEX_COUNT);
+
+	const sf::Vector2f gridPosition(static_cast<float>(OFFSET.x), static_cast<float>(OFFSET.y));
+	const sf::Vector2f gridSize(static_cast<float>(Grid::WIDTH * CELL_SIZE), static_cast<float>(Grid::HEIGHT * CELL_SIZE));
+
+	// Next tetromino box
+	const sf::Vector2f boxPosition(static_cast<float>(windowSize.x) - 6.f * CELL_SIZE, 2.f * CELL_SIZE);
+	const sf::Vector2f boxSize(5.f * CELL_SIZE, 4.f * CELL_SIZE);
+	staticLayer.writeQuad(BACKGROUND_OFFSET, boxPosition, boxSize, EMPTY_COLOR);
+	staticLayer.writeFrame(BACKGROUND_OFFSET + VERTICES_PER_QUAD, boxPosition, boxSize, 2.5f, OUTLINE_COLOR);
+
+	// Grid lines, drawn over the cells along their top and left edges (and the right and bottom edges
+	// of the last column and row), where the outline of each cell used to end up
+	const float lineThickness = 1.5f;
+	const sf::Color lineColor(40, 42, 50, 150);
+	size_t first = GRID_OFFSET;
+	for (unsigned x = 0; x <= Grid::WIDTH; ++x)
+	{
+		const float lineX = gridPosition.x + x * CELL_SIZE - (x < Grid::WIDTH ? lineThickness : 0.f);
+		staticLayer.writeQuad(first, { lineX, gridPosition.y - lineThickness }, { lineThickness, gridSize.y + 2.f * lineThickness }, lineColor);
+		first += VERTICES_PER_QUAD;
+	}
+	for (unsigned y = 0; y <= Grid::HEIGHT; ++y)
+	{
+		const float lineY = gridPosition.y + y * CELL_SIZE - (y < Grid::HEIGHT ? lineThickness : 0.f);
+		staticLayer.writeQuad(first, { gridPosition.x - lineThickness, lineY }, { gridSize.x + 2.f * lineThickness, lineThickness }, lineColor);
+		first += VERTICES_PER_QUAD;
+	}
+	staticLayer.writeFrame(first, gridPosition - sf::Vector2f(1.f, 1.f), gridSize + sf::Vector2f(2.f, 2.f), 2.5f, OUTLINE_COLOR);
+
+	// Top bar and its bottom line
+	staticLayer.writeQuad(FOREGROUND_OFFSET, { 0.f, 0.f }, { static_cast<float>(windowSize.x), OFFSET.y - 4.f }, backgroundColor);
+	staticLayer.writeQuad(FOREGROUND_OFFSET + VERTICES_PER_QUAD, { gridPosition.x, gridPosition.y - 3.5f }, { gridSize.x, 2.5f }, OUTLINE_COLOR);
+
+	staticLayer.upload();
+}
+
+void BoardRenderer::writeTetromino(size_t first, const Tetromino& tetromino, sf::Vector2f position, std::uint8_t alpha)
+{
+	const sf::Vector2f size(CELL_SIZE - 0.75f, CELL_SIZE - 0.75f);
+	const auto& tetrominoCells = tetromino.getCells();
+	sf::Color color = getColor(tetromino.getType());
+	color.a = alpha;
+
+	for (size_t i = 0; i < tetrominoCells.size(); ++i)
+	{
+		sf::Vector2f cellPosition((position.x + tetrominoCells[i].x) * CELL_SIZE + OFFSET.x, (position.y + tetrominoCells[i].y) * CELL_SIZE + OFFSET.y);
+		dynamicLayer.writeQuad(first + i * VERTICES_PER_QUAD, cellPosition, size, color);
+	}
+}
+
+sf::Vector2f BoardRenderer::getNextTetrominoPosition(Tetromino::Type type) const
+{
+	if (type == Tetromino::Type::I)
+		return sf::Vector2f(11.5f, 1.5f);
+	else if (type == Tetromino::Type::O)
+		return sf::Vector2f(12.5f, 2.f);
+	else
+		return sf::Vector2f(12.f, 2.f);
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+// ================================================================================================
+// File: BoardRenderer.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the BoardRenderer class, which is responsible for drawing the state of a
+//              Simulation together with the frame around it. The geometry that never changes (the
+//              top bar, the next tetromino box, the grid lines and outline) lives in a static layer
+//              that is only rebuilt when the layout changes. The grid cells, the ghost piece, the
+//              current tetromino and the next tetromino preview live in a dynamic layer, in which
+//              only the quads that changed since the previous update are rewritten and re-uploaded.
+//              Between two updates, the current tetromino is drawn part of the way from where it was
+//              on the previous step to where it is now, so it moves smoothly on displays that show
+//              more frames than there are simulation steps. What it draws of a simulation is first
+//              captured into a State, which can be copied to another thread and drawn there while
+//              the simulation moves on.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include "Core/Simulation.hpp"
+#include "VertexLayer.hpp"
+
+class BoardRenderer : public sf::Drawable
+{
+public:
+	static constexpr unsigned CELL_SIZE = 50u;
+	static constexpr sf::Vector2u OFFSET = { 50u, 50u };
+	static constexpr sf::Color EMPTY_COLOR = sf::Color(18, 19, 21);
+	static constexpr sf::Color OUTLINE_COLOR = sf::Color(243, 214, 67);
+	static constexpr std::uint8_t GHOST_ALPHA = 55u; // Opacity of the ghost piece in the color of its tetromino
+	static constexpr std::array<sf::Color, Tetromino::TYPE_COUNT> COLORS =
+	{ {
+		sf::Color(0, 255, 255),     // Neon Cyan (I)
+		sf::Color(255, 255, 128),   // Soft Neon Yellow (O)
+		sf::Color(255, 85, 255),    // Neon Magenta (T)
+		sf::Color(0, 255, 128),     // Neon Green (S)
+		sf::Color(255, 80, 80),     // Neon Red (Z)
+		sf::Color(85, 85, 255),     // Neon Blue (J)
+		sf::Color(255, 160, 0)      // Vibrant Orange (L)
+	} };
+
+	static const sf::Color& getColor(Tetromino::Type type) { return COLORS.at(static_cast<size_t>(type)); }
+
+	// Everything drawn of a simulation, copied out of it after every step
+	struct State
+	{
+		static constexpr size_t MAX_FILLED_LINES = 4u;
+
+		Grid::Rows rows{};
+		Grid::Types types{};
+		Simulation::LineFlashPhase lineFlashPhase = Simulation::LineFlashPhase::None;
+		std::array<std::uint8_t, MAX_FILLED_LINES> filledLines{};
+		std::uint8_t filledLineCount = 0u;
+		Tetromino ghost;
+		Tetromino current;
+		Tetromino next;
+		Vector2i previousPosition; // Of the current tetromino on the capture before
+		bool canInterpolate = false; // The current tetromino only moved since the capture before
+		bool isCaptured = false;
+
+		// Copy the simulation, keeping the position of the current tetromino on the previous capture
+		void capture(const Simulation& simulation);
+	};
+
+	BoardRenderer();
+
+	// Set the size of the window and its background colour; the static geometry is rebuilt on the next update
+	void setLayout(sf::Vector2u windowSize, sf::Color backgroundColor);
+	// Rewrite the quads that changed since the last update from a captured state
+	void update(const State& state);
+	// Capture the current state of the simulation and update from it
+	void update(const Simulation& simulation);
+	// Draw the current tetromino `alpha` (0 to 1) of the way from its position on the capture
+	// before the last to the one on the last; a tetromino that was rotated or just spawned isn't moved
+	void interpolate(float alpha);
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+	static constexpr size_t VERTICES_PER_QUAD = VertexLayer::VERTICES_PER_QUAD;
+	static constexpr size_t VERTICES_PER_FRAME = VertexLayer::VERTICES_PER_FRAME;
+	static constexpr size_t VERTICES_PER_TETROMINO = 4u * VERTICES_PER_QUAD;
+	static constexpr size_t CELL_COUNT = Grid::WIDTH * Grid::HEIGHT;
+
+	// Layout of the dynamic layer
+	static constexpr size_t CELLS_OFFSET = 0u;
+	static constexpr size_t GHOST_TETROMINO_OFFSET = CELLS_OFFSET + CELL_COUNT * VERTICES_PER_QUAD;
+	static constexpr size_t CURRENT_TETROMINO_OFFSET = GHOST_TETROMINO_OFFSET + VERTICES_PER_TETROMINO;
+	static constexpr size_t NEXT_TETROMINO_OFFSET = CURRENT_TETROMINO_OFFSET + VERTICES_PER_TETROMINO;
+	static constexpr size_t DYNAMIC_VERTEX_COUNT = NEXT_TETROMINO_OFFSET + VERTICES_PER_TETROMINO;
+
+	// Layout of the static layer, split into the parts drawn below, between and above the dynamic layer
+	static constexpr size_t GRID_LINE_COUNT = (Grid::WIDTH + 1) + (Grid::HEIGHT + 1);
+	static constexpr size_t BACKGROUND_OFFSET = 0u; // Next tetromino box
+	static constexpr size_t BACKGROUND_VERTEX_COUNT = VERTICES_PER_QUAD + VERTICES_PER_FRAME;
+	static constexpr size_t GRID_OFFSET = BACKGROUND_OFFSET + BACKGROUND_VERTEX_COUNT; // Grid lines and outline
+	static constexpr size_t GRID_VERTEX_COUNT = GRID_LINE_COUNT * VERTICES_PER_QUAD + VERTICES_PER_FRAME;
+	static constexpr size_t FOREGROUND_OFFSET = GRID_OFFSET + GRID_VERTEX_COUNT; // Top bar and its bottom line
+	static constexpr size_t FOREGROUND_VERTEX_COUNT = 2u * VERTICES_PER_QUAD;
+	static constexpr size_t STATIC_VERTEX_COUNT = FOREGROUND_OFFSET + FOREGROUND_VERTEX_COUNT;
+
+	void buildStaticGeometry();
+
+	// Rewrite the quads of a tetromino drawn at the given (fractional) grid position
+	void writeTetromino(size_t first, const Tetromino& tetromino, sf::Vector2f position, std::uint8_t alpha = 255u);
+	// Position of the next tetromino display, centered on the right side of the screen
+	sf::Vector2f getNextTetrominoPosition(Tetromino::Type type) const;
+
+	VertexLayer staticLayer;
+	VertexLayer dynamicLayer;
+
+	sf::Vector2u windowSize;
+	sf::Color backgroundColor;
+	bool isLayoutChanged;
+
+	std::array<sf::Color, CELL_COUNT> cellColors;
+	Tetromino drawnGhostTetromino;
+	Tetromino drawnCurrentTetromino;
+	Tetromino drawnNextTetromino;
+	bool areTetrominoesDrawn;
+
+	State capturedState; // For updates straight from a simulation
+
+	// Interpolation of the current tetromino
+	sf::Vector2f previousCurrentPosition; // Grid position on the capture before the last
+	sf::Vector2f drawnCurrentPosition; // Grid position its quads are written at
+	bool canInterpolate;
+};
\ No newline at end of file
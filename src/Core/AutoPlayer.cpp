@@ -0,0 +1,328 @@
+// ================================================================================================
+// File: AutoPlayer.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include "AutoPlayer.hpp"
+
+namespace
+{
+	unsigned countBits(Grid::Row row)
+	{
+		unsigned count = 0u;
+		for (; row != 0u; row &= static_cast<Grid::Row>(row - 1u))
+			++count;
+		return count;
+	}
+
+	// Remove the filled rows and return how many there were
+	unsigned clearFilledRows(Grid::Rows& rows)
+	{
+		unsigned linesCleared = 0u;
+		int destination = Grid::HEIGHT - 1;
+		for (int y = Grid::HEIGHT - 1; y >= 0; --y)
+		{
+			if (rows[y] == Grid::FULL_ROW)
+			{
+				++linesCleared;
+				continue;
+			}
+			rows[destination--] = rows[y];
+		}
+		for (; destination >= 0; --destination)
+			rows[destination] = Grid::EMPTY_ROW;
+		return linesCleared;
+	}
+}
+
+AutoPlayer::AutoPlayer() :
+	AutoPlayer(Weights())
+{
+}
+
+AutoPlayer::AutoPlayer(const Weights& weights) :
+	weights(weights)
+{
+	reset();
+}
+
+void AutoPlayer::reset()
+{
+	searchRows.fill(Grid::EMPTY_ROW);
+	searchType = Tetromino::Type::I;
+	searchNextType = Tetromino::Type::I;
+	searchRotation = 0u;
+	isSearchTwentyG = false;
+	hasSearch = false;
+	phase = SearchPhase::Complete;
+	cursor = 0u;
+	placementCount = 0u;
+	refineIndex = 0u;
+	refineBestScore = -std::numeric_limits<float>::infinity();
+	bestPlacement = 0u;
+	hasRefinedPlacement = false;
+	evaluationCount = 0u;
+}
+
+Simulation::Input AutoPlayer::update(const Simulation& simulation, std::chrono::microseconds budget)
+{
+	if (simulation.isGameOver())
+		return Simulation::Input();
+
+	updateSearch(simulation);
+
+	// At least one unit of work is done per call, so the search always makes progress
+	const auto deadline = std::chrono::steady_clock::now() + budget;
+	while (searchStep() && std::chrono::steady_clock::now() < deadline)
+		;
+
+	return getInput(simulation);
+}
+
+Simulation::Input AutoPlayer::update(const Simulation& simulation)
+{
+	if (simulation.isGameOver())
+		return Simulation::Input();
+
+	updateSearch(simulation);
+	while (searchStep())
+		;
+
+	return getInput(simulation);
+}
+
+void AutoPlayer::updateSearch(const Simulation& simulation)
+{
+	// Filled lines that are still flashing are searched as already cleared, so clearing them
+	// doesn't restart the search
+	Grid::Rows rows = simulation.getGrid().getRows();
+	clearFilledRows(rows);
+
+	const Tetromino& current = simulation.getCurrentTetromino();
+	const Tetromino& next = simulation.getNextTetromino();
+	if (hasSearch && rows == searchRows && current.getType() == searchType && next.getType() == searchNextType &&
+		simulation.isTwentyG() == isSearchTwentyG)
+		return;
+
+	searchRows = rows;
+	searchType = current.getType();
+	searchNextType = next.getType();
+	searchStart = current.position;
+	searchRotation = current.getRotation();
+	searchNextStart = next.position;
+	isSearchTwentyG = simulation.isTwentyG();
+	hasSearch = true;
+
+	phase = SearchPhase::Rating;
+	cursor = 0u;
+	placementCount = 0u;
+	bestPlacement = 0u;
+	hasRefinedPlacement = false;
+}
+
+bool AutoPlayer::searchStep()
+{
+	switch (phase)
+	{
+	case SearchPhase::Rating:
+		if (cursor < MAX_PLACEMENTS)
+		{
+			// Rotations are tried starting from the current one, so ties don't cost a rotation
+			const unsigned rotationOffset = cursor / COLUMN_COUNT;
+			const int x = MIN_X + static_cast<int>(cursor % COLUMN_COUNT);
+			++cursor;
+
+			// All rotations of O look the same
+			if (searchType == Tetromino::Type::O && rotationOffset > 0u)
+				return true;
+
+			Placement& placement = placements[placementCount];
+			const unsigned rotation = (searchRotation + rotationOffset) % Tetromino::ROTATION_COUNT;
+			if (place(searchRows, searchType, rotation, searchStart, x, placement))
+			{
+				placement.score = placement.isLosing ? LOSING_SCORE : evaluate(placement.rows, placement.linesCleared);
+				++placementCount;
+			}
+			return true;
+		}
+
+		if (placementCount == 0u)
+		{
+			phase = SearchPhase::Complete;
+			return false;
+		}
+
+		for (size_t i = 0; i < placementCount; ++i)
+			refineOrder[i] = i;
+		std::stable_sort(refineOrder.begin(), refineOrder.begin() + placementCount,
+			[this](size_t a, size_t b) { return placements[a].score > placements[b].score; });
+
+		bestPlacement = refineOrder[0];
+		phase = SearchPhase::Refining;
+		refineIndex = 0u;
+		cursor = 0u;
+		refineBestScore = -std::numeric_limits<float>::infinity();
+		return true;
+
+	case SearchPhase::Refining:
+	{
+		Placement& placement = placements[refineOrder[refineIndex]];
+		if (!placement.isLosing && cursor < MAX_PLACEMENTS)
+		{
+			const unsigned rotation = cursor / COLUMN_COUNT;
+			const int x = MIN_X + static_cast<int>(cursor % COLUMN_COUNT);
+			++cursor;
+
+			Placement nextPlacement;
+			if (!(searchNextType == Tetromino::Type::O && rotation > 0u) &&
+				place(placement.rows, searchNextType, rotation, searchNextStart, x, nextPlacement))
+			{
+				const float score = nextPlacement.isLosing ? LOSING_SCORE : evaluate(nextPlacement.rows, placement.linesCleared + nextPlacement.linesCleared);
+				refineBestScore = std::max(refineBestScore, score);
+			}
+			return true;
+		}
+
+		// Every placement of the next tetromino was tried on this board
+		placement.score = placement.isLosing ? LOSING_SCORE : std::max(refineBestScore, LOSING_SCORE);
+		if (!hasRefinedPlacement || placement.score > placements[bestPlacement].score)
+			bestPlacement = refineOrder[refineIndex];
+		hasRefinedPlacement = true;
+
+		cursor = 0u;
+		refineBestScore = -std::numeric_limits<float>::infinity();
+		if (++refineIndex == placementCount)
+			phase = SearchPhase::Complete;
+		return true;
+	}
+
+	case SearchPhase::Complete:
+		return false;
+	}
+	return false;
+}
+
+bool AutoPlayer::place(const Grid::Rows& rows, Tetromino::Type type, unsigned rotation, Vector2i start, int x, Placement& placement) const
+{
+	const Tetromino::RowMasks& masks = Tetromino::ORIENTATIONS[static_cast<size_t>(type)][rotation].rowMasks;
+	Vector2i position = start;
+
+	// A tetromino that spawns partly above the grid has to fall into it before it can move. Under
+	// 20G it already rests on the stack, where rotating kicks it up instead.
+	const int step = isSearchTwentyG ? -1 : 1;
+	for (int moved = 0; Grid::doesCollide(rows, masks, position); ++moved)
+	{
+		if (moved == 2)
+			return false;
+		position.y += step;
+	}
+	const auto drop = [&]()
+		{
+			while (!Grid::doesCollide(rows, masks, position + Vector2i{ 0, 1 }))
+				++position.y;
+		};
+	if (isSearchTwentyG)
+		drop();
+	while (position.x != x)
+	{
+		position.x += x < position.x ? -1 : 1;
+		if (Grid::doesCollide(rows, masks, position))
+			return false;
+		if (isSearchTwentyG)
+			drop();
+	}
+	drop();
+
+	placement.position = position;
+	placement.rotation = rotation;
+	placement.rows = rows;
+	const int shift = position.x + static_cast<int>(Grid::WALL_WIDTH);
+	for (int y = 0; y < 4; ++y)
+		if (masks[y] != 0u)
+			placement.rows[position.y + y] |= static_cast<Grid::Row>(masks[y] << shift);
+
+	// Same rule as the simulation, which checks the top row before clearing any lines
+	placement.isLosing = placement.rows[0] != Grid::EMPTY_ROW;
+	placement.linesCleared = clearFilledRows(placement.rows);
+	return true;
+}
+
+float AutoPlayer::evaluate(const Grid::Rows& rows, unsigned linesCleared)
+{
+	++evaluationCount;
+
+	constexpr Grid::Row PLAYFIELD = static_cast<Grid::Row>(~Grid::EMPTY_ROW);
+	std::array<int, Grid::WIDTH> heights{};
+	Grid::Row covered = 0u; // Columns with a filled cell at or above the current row
+	unsigned holes = 0u;
+
+	for (unsigned y = 0; y < Grid::HEIGHT; ++y)
+	{
+		const Grid::Row cells = rows[y] & PLAYFIELD;
+		for (Grid::Row tops = cells & ~covered; tops != 0u; tops &= static_cast<Grid::Row>(tops - 1u))
+		{
+			unsigned bit = 0u;
+			while (!(tops & (1u << bit)))
+				++bit;
+			heights[bit - Grid::WALL_WIDTH] = static_cast<int>(Grid::HEIGHT - y);
+		}
+		holes += countBits(covered & static_cast<Grid::Row>(~cells));
+		covered |= cells;
+	}
+
+	int aggregateHeight = 0;
+	int bumpiness = 0;
+	for (unsigned x = 0; x < Grid::WIDTH; ++x)
+	{
+		aggregateHeight += heights[x];
+		if (x + 1 < Grid::WIDTH)
+			bumpiness += std::abs(heights[x] - heights[x + 1]);
+	}
+
+	return weights.aggregateHeight * aggregateHeight +
+		weights.linesCleared * linesCleared +
+		weights.holes * holes +
+		weights.bumpiness * bumpiness;
+}
+
+Simulation::Input AutoPlayer::getInput(const Simulation& simulation)
+{
+	const Tetromino& tetromino = simulation.getCurrentTetromino();
+	Simulation::Input input;
+	if (placementCount == 0u)
+		return input;
+
+	const Placement& target = placements[bestPlacement];
+	const unsigned turns = (target.rotation + Tetromino::ROTATION_COUNT - tetromino.getRotation()) % Tetromino::ROTATION_COUNT;
+
+	if (turns == 1u)
+		input.rotateCW = true;
+	else if (turns == 2u)
+		input.rotate180 = true;
+	else if (turns == 3u)
+		input.rotateCCW = true;
+	else if (tetromino.position.x != target.position.x)
+	{
+		// One column per tick, about as fast as a player tapping
+		input.shift = target.position.x < tetromino.position.x ? -1 : 1;
+	}
+	// Only drop once the search has settled on a placement, until then gravity decides when it locks.
+	// The search treats flashing lines as cleared, so a hard drop has to wait until they are, or the
+	// tetromino would land on top of them.
+	else if (isSearchComplete())
+	{
+		if (simulation.getFilledLines().empty())
+			input.hardDrop = true;
+		else
+			input.down = true;
+	}
+
+	return input;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+// ================================================================================================
+// File: AutoPlayer.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the AutoPlayer class, a bot that plays a Simulation through the same input
+//              a player would give it. For every new tetromino it searches the placements of the
+//              current tetromino, rating the board each one leaves behind, then refines the best
+//              ones by also trying every placement of the next tetromino. The search is anytime: it
+//              runs in slices of a given time budget per tick and always has a best placement ready,
+//              which it steers the tetromino towards until gravity locks it in.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <chrono>
+#include "Simulation.hpp"
+
+class AutoPlayer
+{
+public:
+	// Weights of the board features that rate a placement
+	struct Weights
+	{
+		float aggregateHeight = -0.510066f;
+		float linesCleared = 0.760666f;
+		float holes = -0.35663f;
+		float bumpiness = -0.184483f;
+	};
+
+	AutoPlayer();
+	explicit AutoPlayer(const Weights& weights);
+	void reset();
+
+	// Continue the search for the current tetromino for at most `budget`, then return the input for
+	// the next tick, which moves the tetromino towards the best placement found so far
+	Simulation::Input update(const Simulation& simulation, std::chrono::microseconds budget);
+	// Same as above, but always finish the search first, so the moves only depend on the game state
+	Simulation::Input update(const Simulation& simulation);
+
+	bool isSearchComplete() const { return phase == SearchPhase::Complete; }
+	// Number of boards rated since the last reset
+	unsigned long long getEvaluationCount() const { return evaluationCount; }
+
+private:
+	static constexpr int MIN_X = -static_cast<int>(Grid::WALL_WIDTH);
+	static constexpr unsigned COLUMN_COUNT = Grid::WIDTH + Grid::WALL_WIDTH;
+	static constexpr size_t MAX_PLACEMENTS = Tetromino::ROTATION_COUNT * COLUMN_COUNT;
+	static constexpr float LOSING_SCORE = -1e9f;
+
+	struct Placement
+	{
+		Vector2i position;
+		unsigned rotation;
+		Grid::Rows rows; // Board after the tetromino is locked and the filled lines cleared
+		unsigned linesCleared;
+		bool isLosing;
+		float score; // Rating of the board alone, then with the best next placement once refined
+	};
+
+	enum class SearchPhase
+	{
+		Rating,   // Rating every placement of the current tetromino
+		Refining, // Trying every placement of the next tetromino on the best boards first
+		Complete
+	};
+
+	// Start a new search if the board or the tetrominoes changed since the last one
+	void updateSearch(const Simulation& simulation);
+	// Run a single unit of search work, returning false once there is nothing left to do
+	bool searchStep();
+
+	// Drop a tetromino from `start` after rotating it and moving it to column `x` and lock it into a
+	// copy of the rows, returning false if the placement can't be reached. Under 20G the tetromino
+	// falls as far as it can after every move, so it can't cross gaps in the stack.
+	bool place(const Grid::Rows& rows, Tetromino::Type type, unsigned rotation, Vector2i start, int x, Placement& placement) const;
+	float evaluate(const Grid::Rows& rows, unsigned linesCleared);
+
+	Simulation::Input getInput(const Simulation& simulation);
+
+	Weights weights;
+
+	// Search state
+	Grid::Rows searchRows;
+	Tetromino::Type searchType;
+	Tetromino::Type searchNextType;
+	Vector2i searchStart;
+	unsigned searchRotation;
+	Vector2i searchNextStart;
+	bool isSearchTwentyG;
+	bool hasSearch;
+
+	SearchPhase phase;
+	unsigned cursor; // Next (rotation, column) candidate of the tetromino being placed
+	std::array<Placement, MAX_PLACEMENTS> placements;
+	size_t placementCount;
+	std::array<size_t, MAX_PLACEMENTS> refineOrder; // Placements sorted by their rating
+	size_t refineIndex;
+	float refineBestScore; // Best rating with the next tetromino for the placement being refined
+	size_t bestPlacement;
+	bool hasRefinedPlacement;
+
+	unsigned long long evaluationCount;
+};
\ No newline at end of file
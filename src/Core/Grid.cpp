@@ -0,0 +1,188 @@
+// ================================================================================================
+// File: Grid.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 8, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <iostream>
+#include "Grid.hpp"
+
+Grid::Grid()
+{
+	reset();
+}
+
+void Grid::reset()
+{
+	rows.fill(EMPTY_ROW);
+	types.fill(Tetromino::Type::I);
+	columnHeights.fill(0u);
+}
+
+std::vector<unsigned> Grid::getFilledLines() const
+{
+	std::vector<unsigned> filledLines;
+	for (unsigned y = 0; y < HEIGHT; ++y)
+	{
+		if (rows[y] == FULL_ROW)
+			filledLines.push_back(y);
+	}
+	return filledLines;
+}
+
+void Grid::clearFilledLinesAndPushDown(const std::vector<unsigned>& filledLines)
+{
+	std::uint32_t clearedLines = 0u;
+	for (const auto& line : filledLines)
+		clearedLines |= 1u << line;
+
+	// Compact the remaining rows towards the bottom in a single pass
+	int destination = HEIGHT - 1;
+	for (int y = HEIGHT - 1; y >= 0; --y)
+	{
+		if (clearedLines & (1u << y))
+			continue;
+
+		if (destination != y)
+		{
+			rows[destination] = rows[y];
+			std::copy_n(&types[y * WIDTH], WIDTH, &types[destination * WIDTH]);
+		}
+		--destination;
+	}
+	// Rows left at the top are now empty
+	for (; destination >= 0; --destination)
+	{
+		rows[destination] = EMPTY_ROW;
+		std::fill_n(&types[destination * WIDTH], WIDTH, Tetromino::Type::I);
+	}
+
+	// Cleared lines are filled in every column, so every column loses at least that many rows of
+	// height. It only loses more if its top cell was cleared and there is a gap below it, in which
+	// case its new top is found walking down from there.
+	const unsigned clearedCount = static_cast<unsigned>(filledLines.size());
+	for (unsigned x = 0; x < WIDTH; ++x)
+	{
+		unsigned height = columnHeights[x] - clearedCount;
+		while (height > 0u && (rows[HEIGHT - height] & getColumnBit(x)) == 0u)
+			--height;
+		columnHeights[x] = static_cast<std::uint8_t>(height);
+	}
+}
+
+int Grid::getDropDistance(const Tetromino& tetromino) const
+{
+	const Tetromino::Orientation& orientation = tetromino.getOrientation();
+	int distance = HEIGHT;
+	for (int column = 0; column < 4; ++column)
+	{
+		const int bottom = orientation.columnBottoms[column];
+		if (bottom < 0)
+			continue;
+
+		const int x = tetromino.position.x + column;
+		const int cellY = tetromino.position.y + bottom;
+		const int topY = static_cast<int>(HEIGHT - columnHeights[x]); // First filled row, or the floor
+		// A tetromino tucked under an overhang can't use the heights and has to probe the rows
+		if (cellY >= topY)
+		{
+			distance = 0;
+			while (!doesCollide(orientation.rowMasks, tetromino.position + Vector2i{ 0, distance + 1 }))
+				++distance;
+			return distance;
+		}
+		distance = std::min(distance, topY - 1 - cellY);
+	}
+	return distance;
+}
+
+bool Grid::doesCollide(const Rows& rows, const Tetromino::RowMasks& masks, Vector2i position)
+{
+	// Shapes are 4 columns wide, so any shift that would push them past the walls is out of bounds
+	const int shift = position.x + static_cast<int>(WALL_WIDTH);
+	if (shift < 0 || shift > 16 - 4)
+		return true;
+
+	// Fast path: all four shape rows are inside the grid, so no row needs bounds checking
+	if (position.y >= 0 && position.y + 4 <= static_cast<int>(HEIGHT))
+	{
+		const Row* gridRows = &rows[position.y];
+		return ((gridRows[0] & (masks[0] << shift)) |
+			(gridRows[1] & (masks[1] << shift)) |
+			(gridRows[2] & (masks[2] << shift)) |
+			(gridRows[3] & (masks[3] << shift))) != 0;
+	}
+
+	for (int y = 0; y < 4; ++y)
+	{
+		if (masks[y] == 0u)
+			continue;
+
+		const int gridY = position.y + y;
+		if (gridY < 0 || gridY >= static_cast<int>(HEIGHT))
+			return true;
+
+		if (rows[gridY] & (masks[y] << shift))
+			return true;
+	}
+	return false;
+}
+
+bool Grid::isCellFilled(Vector2i position) const
+{
+	if (position.x >= 0 && position.x < static_cast<int>(WIDTH) &&
+		position.y >= 0 && position.y < static_cast<int>(HEIGHT))
+	{
+		return (rows[position.y] & getColumnBit(position.x)) != 0u;
+	}
+	else
+	{
+		std::cerr << "Error: Attempted to check a cell outside the grid bounds." << std::endl;
+		return false;
+	}
+}
+
+Tetromino::Type Grid::getCellType(Vector2i position) const
+{
+	if (position.x >= 0 && position.x < static_cast<int>(WIDTH) &&
+		position.y >= 0 && position.y < static_cast<int>(HEIGHT))
+	{
+		return types[position.y * WIDTH + position.x];
+	}
+	else
+	{
+		std::cerr << "Error: Attempted to get the type of a cell outside the grid bounds." << std::endl;
+		return Tetromino::Type::I;
+	}
+}
+
+void Grid::fillCell(Vector2i position, Tetromino::Type type)
+{
+	if (position.x >= 0 && position.x < static_cast<int>(WIDTH) &&
+		position.y >= 0 && position.y < static_cast<int>(HEIGHT))
+	{
+		types[position.y * WIDTH + position.x] = type;
+		rows[position.y] |= getColumnBit(position.x);
+		columnHeights[position.x] = std::max(columnHeights[position.x], static_cast<std::uint8_t>(HEIGHT - position.y));
+	}
+	else
+		std::cerr << "Error: Attempted to fill a cell outside the grid bounds." << std::endl;
+}
+
+std::uint64_t Grid::getHash() const
+{
+	// FNV-1a over the occupancy rows and the type plane
+	std::uint64_t hash = 0xCBF29CE484222325ull;
+	for (const Row row : rows)
+	{
+		hash = (hash ^ (row & 0xFFu)) * 0x100000001B3ull;
+		hash = (hash ^ (row >> 8)) * 0x100000001B3ull;
+	}
+	for (const Tetromino::Type type : types)
+		hash = (hash ^ static_cast<std::uint8_t>(type)) * 0x100000001B3ull;
+	return hash;
+}
\ No newline at end of file
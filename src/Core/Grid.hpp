@@ -0,0 +1,94 @@
+// ================================================================================================
+// File: Grid.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 8, 2025
+// Description: Defines the Grid class, which is responsible for creating and managing a grid of cells.
+//              Occupancy is stored as one 16-bit mask per row, with the playfield columns in the
+//              middle bits and the unused bits on both sides permanently set to act as walls. This
+//              way collision tests, filled line checks and line clears are a handful of integer
+//              operations per row instead of per-cell lookups. The type of the tetromino that
+//              filled each cell is kept in a separate plane of one byte per cell, so the whole board
+//              is a couple hundred bytes of plain data that is cheap to copy, compare and hash, and
+//              everything needed to draw it is derived from those two arrays. The height of every
+//              column is kept up to date as cells are filled and lines cleared, so the row a
+//              tetromino lands on is found from its lowest cell in each column instead of probing
+//              the rows below it one at a time.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <type_traits>
+#include <vector>
+#include "Tetromino.hpp"
+
+class Grid
+{
+public:
+	static constexpr unsigned WIDTH = 10u;
+	static constexpr unsigned HEIGHT = 20u;
+
+	using Row = std::uint16_t;
+	using Rows = std::array<Row, HEIGHT>;
+	using Types = std::array<Tetromino::Type, WIDTH * HEIGHT>; // Row by row, top row first
+	static constexpr unsigned WALL_WIDTH = 3u; // Number of wall bits left of column 0
+	static constexpr Row FULL_ROW = 0xFFFFu;
+	static constexpr Row EMPTY_ROW = static_cast<Row>(FULL_ROW & ~(((1u << WIDTH) - 1u) << WALL_WIDTH));
+
+	Grid();
+	void reset();
+
+	void fillCell(Vector2i position, Tetromino::Type type);
+
+	// Check for filled lines and return their indices
+	std::vector<unsigned> getFilledLines() const;
+	// Clear the filled lines and push down the lines above by number of filled lines
+	void clearFilledLinesAndPushDown(const std::vector<unsigned>& filledLines);
+
+	// Check if a shape given as row masks (bit x = column x) at the given position overlaps a filled
+	// cell or lies outside the grid
+	bool doesCollide(const Tetromino::RowMasks& masks, Vector2i position) const { return doesCollide(rows, masks, position); }
+	// Same test against a bare set of rows, used to search placements without copying a whole grid
+	static bool doesCollide(const Rows& rows, const Tetromino::RowMasks& masks, Vector2i position);
+
+	// Number of rows the tetromino can fall from its position before it collides
+	int getDropDistance(const Tetromino& tetromino) const;
+	// Height of the highest filled cell in the column above the bottom of the grid, 0 if it's empty
+	unsigned getColumnHeight(unsigned x) const { return columnHeights[x]; }
+
+	bool isCellFilled(Vector2i position) const;
+	// Returns the type of the tetromino that filled the cell, only meaningful if the cell is filled
+	Tetromino::Type getCellType(Vector2i position) const;
+
+	const Rows& getRows() const { return rows; }
+	const Types& getTypes() const { return types; }
+
+	// Empty cells always hold the first type, so equal boards compare and hash equal; the column
+	// heights follow from the rows
+	bool operator==(const Grid& other) const { return rows == other.rows && types == other.types; }
+	bool operator!=(const Grid& other) const { return !(*this == other); }
+	std::uint64_t getHash() const;
+
+private:
+	static constexpr Row getColumnBit(int x) { return static_cast<Row>(1u << (x + WALL_WIDTH)); }
+
+	Rows rows;
+	Types types;
+	std::array<std::uint8_t, WIDTH> columnHeights;
+};
+
+static_assert(std::is_trivially_copyable_v<Grid>, "Grid must stay plain data so it can be copied and snapshotted cheaply");
+
+namespace std
+{
+	template<>
+	struct hash<Grid>
+	{
+		size_t operator()(const Grid& grid) const noexcept
+		{
+			return static_cast<size_t>(grid.getHash());
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+// ================================================================================================
+// File: Replay.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include "Replay.hpp"
+
+namespace
+{
+	// Bits of the recorded input, followed by the sideways shift zigzag-encoded (0, -1, 1, -2, ...)
+	// so that a shift of a single column still fits in one byte of the varint
+	constexpr unsigned DOWN = 1u << 0;
+	constexpr unsigned ROTATE_CW = 1u << 1;
+	constexpr unsigned ROTATE_CCW = 1u << 2;
+	constexpr unsigned ROTATE_180 = 1u << 3;
+	constexpr unsigned HARD_DROP = 1u << 4;
+	constexpr unsigned SHIFT_BIT = 5u;
+
+	// Header fields are written as little-endian integers of a fixed size
+	void writeUint(std::vector<std::uint8_t>& data, std::uint64_t value, unsigned size)
+	{
+		for (unsigned i = 0; i < size; ++i)
+			data.push_back(static_cast<std::uint8_t>(value >> (8u * i)));
+	}
+
+	std::uint64_t readUint(const std::vector<std::uint8_t>& data, size_t& offset, unsigned size)
+	{
+		std::uint64_t value = 0u;
+		for (unsigned i = 0; i < size; ++i)
+			value |= static_cast<std::uint64_t>(data[offset++]) << (8u * i);
+		return value;
+	}
+
+	void writeVarint(std::vector<std::uint8_t>& data, unsigned value)
+	{
+		// 7 bits per byte, the high bit is set on every byte but the last
+		while (value >= 0x80u)
+		{
+			data.push_back(static_cast<std::uint8_t>(value | 0x80u));
+			value >>= 7;
+		}
+		data.push_back(static_cast<std::uint8_t>(value));
+	}
+
+	// FNV-1a
+	void hashBytes(std::uint64_t& hash, std::uint64_t value, unsigned size)
+	{
+		for (unsigned i = 0; i < size; ++i)
+		{
+			hash ^= static_cast<std::uint8_t>(value >> (8u * i));
+			hash *= 0x100000001B3ull;
+		}
+	}
+
+	constexpr size_t HEADER_SIZE = 4u + 1u + 4u + 4u + 4u + 4u + 8u + 4u;
+}
+
+Replay::Player::Player() :
+	replay(nullptr),
+	offset(0u),
+	tick(0u),
+	hasPendingEdge(false),
+	pendingEdgeTick(0u),
+	pendingInput(0u),
+	currentInput(0u)
+{
+}
+
+Replay::Player::Player(const Replay& replay) :
+	Player()
+{
+	this->replay = &replay;
+	readEdge();
+}
+
+Simulation::Input Replay::Player::next()
+{
+	if (isFinished())
+		return Simulation::Input();
+
+	if (hasPendingEdge && pendingEdgeTick == tick)
+	{
+		currentInput = pendingInput;
+		readEdge();
+	}
+	++tick;
+	return decodeInput(currentInput);
+}
+
+void Replay::Player::readEdge()
+{
+	unsigned delta = 0u;
+	hasPendingEdge = offset < replay->edges.size() && replay->readVarint(offset, delta);
+	if (!hasPendingEdge)
+		return;
+
+	pendingEdgeTick += delta;
+	hasPendingEdge = replay->readVarint(offset, pendingInput);
+}
+
+Replay::Replay()
+{
+	start(0u);
+}
+
+void Replay::start(std::uint32_t seed)
+{
+	this->seed = seed;
+	tickCount = 0u;
+	score = 0u;
+	linesCleared = 0u;
+	stateHash = 0u;
+	edges.clear();
+	lastEdgeTick = 0u;
+	lastInput = 0u;
+}
+
+void Replay::record(const Simulation::Input& input)
+{
+	const unsigned bits = encodeInput(input);
+	if (bits != lastInput)
+	{
+		writeVarint(edges, tickCount - lastEdgeTick);
+		writeVarint(edges, bits);
+		lastEdgeTick = tickCount;
+		lastInput = bits;
+	}
+	++tickCount;
+}
+
+void Replay::truncate(unsigned tickCount)
+{
+	if (tickCount >= this->tickCount)
+		return;
+
+	// Keep the edges before the tick, along with the input they left off at
+	size_t offset = 0u;
+	size_t end = 0u;
+	unsigned tick = 0u;
+	lastEdgeTick = 0u;
+	lastInput = 0u;
+	unsigned delta = 0u;
+	unsigned bits = 0u;
+	while (offset < edges.size() && readVarint(offset, delta) && readVarint(offset, bits))
+	{
+		tick += delta;
+		if (tick >= tickCount)
+			break;
+
+		end = offset;
+		lastEdgeTick = tick;
+		lastInput = bits;
+	}
+	edges.resize(end);
+	this->tickCount = tickCount;
+}
+
+void Replay::finish(const Simulation& simulation)
+{
+	score = simulation.getScore();
+	linesCleared = simulation.getTotalLinesCleared();
+	stateHash = getStateHash(simulation);
+}
+
+bool Replay::matches(const Simulation& simulation) const
+{
+	return simulation.getScore() == score &&
+		simulation.getTotalLinesCleared() == linesCleared &&
+		getStateHash(simulation) == stateHash;
+}
+
+bool Replay::saveToFile(const std::string& path) const
+{
+	std::vector<std::uint8_t> data;
+	data.reserve(HEADER_SIZE + edges.size());
+	data.insert(data.end(), std::begin(MAGIC), std::end(MAGIC));
+	writeUint(data, FORMAT_VERSION, 1u);
+	writeUint(data, seed, 4u);
+	writeUint(data, tickCount, 4u);
+	writeUint(data, score, 4u);
+	writeUint(data, linesCleared, 4u);
+	writeUint(data, stateHash, 8u);
+	writeUint(data, edges.size(), 4u);
+	data.insert(data.end(), edges.begin(), edges.end());
+
+	std::ofstream file(path, std::ios::binary);
+	if (!file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size())))
+	{
+		std::cerr << "Error: Failed to save the replay to " << path << "." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool Replay::loadFromFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	const std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (!file.good() && !file.eof())
+	{
+		std::cerr << "Error: Failed to load the replay from " << path << "." << std::endl;
+		return false;
+	}
+	if (data.size() < HEADER_SIZE || !std::equal(std::begin(MAGIC), std::end(MAGIC), data.begin()))
+	{
+		std::cerr << "Error: " << path << " is not a replay." << std::endl;
+		return false;
+	}
+
+	size_t offset = sizeof(MAGIC);
+	if (readUint(data, offset, 1u) != FORMAT_VERSION)
+	{
+		std::cerr << "Error: The replay " << path << " was recorded in an unsupported format version." << std::endl;
+		return false;
+	}
+
+	Replay replay;
+	replay.seed = static_cast<std::uint32_t>(readUint(data, offset, 4u));
+	replay.tickCount = static_cast<unsigned>(readUint(data, offset, 4u));
+	replay.score = static_cast<unsigned>(readUint(data, offset, 4u));
+	replay.linesCleared = static_cast<unsigned>(readUint(data, offset, 4u));
+	replay.stateHash = readUint(data, offset, 8u);
+	const size_t edgesSize = static_cast<size_t>(readUint(data, offset, 4u));
+	if (data.size() - offset != edgesSize)
+	{
+		std::cerr << "Error: The replay " << path << " is truncated." << std::endl;
+		return false;
+	}
+	replay.edges.assign(data.begin() + offset, data.end());
+
+	*this = std::move(replay);
+	return true;
+}
+
+unsigned Replay::encodeInput(const Simulation::Input& input)
+{
+	const unsigned shift = input.shift < 0 ? 2u * static_cast<unsigned>(-input.shift) - 1u : 2u * static_cast<unsigned>(input.shift);
+	return (input.down ? DOWN : 0u) |
+		(input.rotateCW ? ROTATE_CW : 0u) |
+		(input.rotateCCW ? ROTATE_CCW : 0u) |
+		(input.rotate180 ? ROTATE_180 : 0u) |
+		(input.hardDrop ? HARD_DROP : 0u) |
+		(shift << SHIFT_BIT);
+}
+
+Simulation::Input Replay::decodeInput(unsigned bits)
+{
+	Simulation::Input input;
+	const unsigned shift = bits >> SHIFT_BIT;
+	input.shift = static_cast<std::int8_t>(shift & 1u ? -static_cast<int>((shift + 1u) / 2u) : static_cast<int>(shift / 2u));
+	input.down = (bits & DOWN) != 0u;
+	input.rotateCW = (bits & ROTATE_CW) != 0u;
+	input.rotateCCW = (bits & ROTATE_CCW) != 0u;
+	input.rotate180 = (bits & ROTATE_180) != 0u;
+	input.hardDrop = (bits & HARD_DROP) != 0u;
+	return input;
+}
+
+std::uint64_t Replay::getStateHash(const Simulation& simulation)
+{
+	std::uint64_t hash = 0xCBF29CE484222325ull;
+	for (Grid::Row row : simulation.getGrid().getRows())
+		hashBytes(hash, row, sizeof(row));
+
+	const Tetromino& current = simulation.getCurrentTetromino();
+	hashBytes(hash, static_cast<std::uint64_t>(current.getType()), 1u);
+	hashBytes(hash, current.getRotation(), 1u);
+	hashBytes(hash, static_cast<std::uint32_t>(current.position.x), 4u);
+	hashBytes(hash, static_cast<std::uint32_t>(current.position.y), 4u);
+	hashBytes(hash, static_cast<std::uint64_t>(simulation.getNextTetromino().getType()), 1u);
+	hashBytes(hash, simulation.getScore(), 4u);
+	hashBytes(hash, simulation.getLevel(), 4u);
+	hashBytes(hash, simulation.getTotalLinesCleared(), 4u);
+	return hash;
+}
+
+bool Replay::readVarint(size_t& offset, unsigned& value) const
+{
+	value = 0u;
+	for (unsigned shift = 0u; offset < edges.size() && shift < 32u; shift += 7u)
+	{
+		const std::uint8_t byte = edges[offset++];
+		value |= static_cast<unsigned>(byte & 0x7Fu) << shift;
+		if (!(byte & 0x80u))
+			return true;
+	}
+	return false;
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+// ================================================================================================
+// File: Replay.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the Replay class, a compact recording of a single game. A game is fully
+//              determined by its seed and the input of every tick, so only the seed and the ticks
+//              on which the input changed (the input edges) are stored: each edge is the number of
+//              ticks since the previous one followed by the new input, a few flags and the
+//              sideways shift, both as variable-length integers, usually two bytes in total. The
+//              result of the game and a hash of its final state are stored along with it, so
+//              playing the replay back can verify that it reproduces the same game bit for bit.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Simulation.hpp"
+
+class Replay
+{
+public:
+	static constexpr std::uint8_t FORMAT_VERSION = 4u; // Bumped whenever the rules change how recorded input plays out
+
+	// Reads the input of a replay back one tick at a time
+	class Player
+	{
+	public:
+		Player();
+		explicit Player(const Replay& replay);
+
+		// Input for the next tick, no input once the recording has ended
+		Simulation::Input next();
+		bool isFinished() const { return replay == nullptr || tick >= replay->tickCount; }
+		unsigned getTick() const { return tick; }
+
+	private:
+		void readEdge();
+
+		const Replay* replay;
+		size_t offset; // Position of the next edge in the recorded data
+		unsigned tick;
+		bool hasPendingEdge;
+		unsigned pendingEdgeTick;
+		unsigned pendingInput;
+		unsigned currentInput;
+	};
+
+	Replay();
+
+	// Discard the current recording and start recording a game created with the given seed
+	void start(std::uint32_t seed);
+	// Record the input of the next tick
+	void record(const Simulation::Input& input);
+	// Cut the recording back to its first `tickCount` ticks, e.g. after the game was rewound, so the
+	// ticks from there on are recorded again
+	void truncate(unsigned tickCount);
+	// Store the state the recorded game has reached, which playback verifies against
+	void finish(const Simulation& simulation);
+
+	// True if a simulation that played the replay back ended up in the recorded state
+	bool matches(const Simulation& simulation) const;
+
+	bool saveToFile(const std::string& path) const;
+	bool loadFromFile(const std::string& path);
+
+	std::uint32_t getSeed() const { return seed; }
+	unsigned getTickCount() const { return tickCount; }
+	unsigned getScore() const { return score; }
+	unsigned getLinesCleared() const { return linesCleared; }
+	// Size of the recorded input in bytes
+	size_t getInputSize() const { return edges.size(); }
+
+private:
+	static constexpr char MAGIC[4] = { 'T', 'R', 'P', 'L' };
+
+	static unsigned encodeInput(const Simulation::Input& input);
+	static Simulation::Input decodeInput(unsigned bits);
+	// Hash of everything that determines how the game continues
+	static std::uint64_t getStateHash(const Simulation& simulation);
+
+	// Read a variable-length integer from the edges, returning false if it runs past their end
+	bool readVarint(size_t& offset, unsigned& value) const;
+
+	std::uint32_t seed;
+	unsigned tickCount;
+	unsigned score;
+	unsigned linesCleared;
+	std::uint64_t stateHash;
+
+	std::vector<std::uint8_t> edges;
+	unsigned lastEdgeTick;
+	unsigned lastInput;
+};
\ No newline at end of file
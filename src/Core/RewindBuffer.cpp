@@ -0,0 +1,177 @@
+// ================================================================================================
+// File: RewindBuffer.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <cstring>
+#include "RewindBuffer.hpp"
+
+namespace
+{
+	constexpr size_t SNAPSHOT_SIZE = sizeof(Simulation::Snapshot);
+	constexpr size_t MAX_RUN = 255u; // Changed bytes in a run, so its length fits a byte
+	constexpr size_t MAX_GAP = 2u; // Equal bytes between two changes that are stored rather than start a new run
+
+	void writeVarint(std::vector<std::uint8_t>& data, size_t value)
+	{
+		while (value >= 0x80u)
+		{
+			data.push_back(static_cast<std::uint8_t>(value | 0x80u));
+			value >>= 7;
+		}
+		data.push_back(static_cast<std::uint8_t>(value));
+	}
+
+	size_t readVarint(const std::uint8_t* data, size_t& offset)
+	{
+		size_t value = 0u;
+		for (unsigned shift = 0u; ; shift += 7u)
+		{
+			const std::uint8_t byte = data[offset++];
+			value |= static_cast<size_t>(byte & 0x7Fu) << shift;
+			if ((byte & 0x80u) == 0u)
+				return value;
+		}
+	}
+}
+
+RewindBuffer::RewindBuffer() :
+	firstGroup(0u),
+	groupCount(0u),
+	size(0u)
+{
+}
+
+void RewindBuffer::clear()
+{
+	for (Group& group : groups)
+	{
+		group.deltas.clear();
+		group.deltaEnds.clear();
+	}
+	firstGroup = 0u;
+	groupCount = 0u;
+	size = 0u;
+}
+
+void RewindBuffer::push(const Simulation& simulation)
+{
+	simulation.capture(snapshot);
+
+	if (groupCount > 0u && getGroup(groupCount - 1u).getSize() < KEYFRAME_INTERVAL)
+	{
+		Group& group = getGroup(groupCount - 1u);
+		encode(snapshot, group.keyframe, group.deltas);
+		group.deltaEnds.push_back(static_cast<std::uint32_t>(group.deltas.size()));
+		++size;
+		return;
+	}
+
+	// The newest group is full, so the state starts a new one, in place of the oldest if need be
+	if (groupCount == GROUP_COUNT)
+	{
+		size -= getGroup(0u).getSize();
+		firstGroup = (firstGroup + 1u) % GROUP_COUNT;
+		--groupCount;
+	}
+	Group& group = getGroup(groupCount++);
+	group.keyframe = snapshot;
+	group.deltas.clear();
+	group.deltaEnds.clear();
+	++size;
+}
+
+bool RewindBuffer::stepBack(Simulation& simulation)
+{
+	if (size < 2u)
+		return false;
+
+	Group* group = &getGroup(groupCount - 1u);
+	if (group->deltaEnds.empty())
+	{
+		--groupCount;
+		group = &getGroup(groupCount - 1u);
+	}
+	else
+	{
+		group->deltaEnds.pop_back();
+		group->deltas.resize(group->deltaEnds.empty() ? 0u : group->deltaEnds.back());
+	}
+	--size;
+
+	// The newest state left is either the keyframe itself or its last difference
+	snapshot = group->keyframe;
+	if (!group->deltaEnds.empty())
+	{
+		const size_t begin = group->deltaEnds.size() > 1u ? group->deltaEnds[group->deltaEnds.size() - 2u] : 0u;
+		decode(group->deltas.data() + begin, group->deltaEnds.back() - begin, snapshot);
+	}
+	simulation.restore(snapshot);
+	return true;
+}
+
+size_t RewindBuffer::getMemoryUsage() const
+{
+	size_t usage = sizeof(*this);
+	for (const Group& group : groups)
+		usage += group.deltas.capacity() + group.deltaEnds.capacity() * sizeof(std::uint32_t);
+	return usage;
+}
+
+void RewindBuffer::encode(const Simulation::Snapshot& snapshot, const Simulation::Snapshot& keyframe, std::vector<std::uint8_t>& data)
+{
+	const auto* bytes = reinterpret_cast<const std::uint8_t*>(&snapshot);
+	const auto* keyframeBytes = reinterpret_cast<const std::uint8_t*>(&keyframe);
+
+	// Every run is the number of equal bytes since the previous run, its length and its bytes
+	size_t previousEnd = 0u;
+	for (size_t i = 0u; i < SNAPSHOT_SIZE; )
+	{
+		if (bytes[i] == keyframeBytes[i])
+		{
+			++i;
+			continue;
+		}
+
+		size_t end = i + 1u;
+		while (end < SNAPSHOT_SIZE && end - i < MAX_RUN)
+		{
+			if (bytes[end] != keyframeBytes[end])
+			{
+				++end;
+				continue;
+			}
+			// A short gap costs less inside the run than the header of a new one
+			size_t next = end;
+			while (next < SNAPSHOT_SIZE && next - end <= MAX_GAP && bytes[next] == keyframeBytes[next])
+				++next;
+			if (next == SNAPSHOT_SIZE || next - end > MAX_GAP || next + 1u - i > MAX_RUN)
+				break;
+			end = next;
+		}
+
+		writeVarint(data, i - previousEnd);
+		data.push_back(static_cast<std::uint8_t>(end - i));
+		data.insert(data.end(), bytes + i, bytes + end);
+		previousEnd = end;
+		i = end;
+	}
+}
+
+void RewindBuffer::decode(const std::uint8_t* data, size_t dataSize, Simulation::Snapshot& snapshot)
+{
+	auto* bytes = reinterpret_cast<std::uint8_t*>(&snapshot);
+	size_t position = 0u;
+	for (size_t offset = 0u; offset < dataSize; )
+	{
+		position += readVarint(data, offset);
+		const size_t length = data[offset++];
+		std::memcpy(bytes + position, data + offset, length);
+		offset += length;
+		position += length;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+// ================================================================================================
+// File: RewindBuffer.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the RewindBuffer class, which keeps the state of a simulation after each of
+//              its last CAPACITY steps so the game can be stepped back one tick at a time. The
+//              states are stored in groups of KEYFRAME_INTERVAL: the first one of a group is stored
+//              whole as a keyframe, and every one after it only as the bytes that differ from the
+//              keyframe, as runs of the changed bytes and the number of equal bytes before each.
+//              Within a second only the tetrominoes, a few timers and now and then a few rows
+//              change, so a state usually takes a few dozen bytes instead of a whole snapshot. Any
+//              state is decoded from its keyframe alone, and the oldest group is dropped whole once
+//              the buffer is full. The groups reuse their memory, so storing a state allocates
+//              nothing once the buffer has filled up.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Simulation.hpp"
+
+class RewindBuffer
+{
+public:
+	static constexpr size_t CAPACITY = 30u * Simulation::TICKS_PER_SECOND; // States kept at least, 30 seconds of play
+	static constexpr size_t KEYFRAME_INTERVAL = Simulation::TICKS_PER_SECOND; // States per keyframe, the keyframe included
+
+	RewindBuffer();
+
+	void clear();
+	// Store the state of the simulation after a step
+	void push(const Simulation& simulation);
+	// Drop the newest state and restore the simulation to the one before it, returning false if
+	// there is none to go back to
+	bool stepBack(Simulation& simulation);
+
+	size_t getSize() const { return size; }
+	// Bytes taken up by the keyframes and the differences, including the capacity reserved for them
+	size_t getMemoryUsage() const;
+
+private:
+	static constexpr size_t GROUP_COUNT = CAPACITY / KEYFRAME_INTERVAL + 1u; // One more to fill while the oldest is dropped
+
+	struct Group
+	{
+		Simulation::Snapshot keyframe;
+		std::vector<std::uint8_t> deltas; // Differences of the states after the keyframe, one after another
+		std::vector<std::uint32_t> deltaEnds; // Offset of the end of every difference
+
+		size_t getSize() const { return 1u + deltaEnds.size(); }
+	};
+
+	// Append the bytes of the snapshot that differ from the keyframe
+	static void encode(const Simulation::Snapshot& snapshot, const Simulation::Snapshot& keyframe, std::vector<std::uint8_t>& data);
+	// Apply a difference to a copy of its keyframe
+	static void decode(const std::uint8_t* data, size_t dataSize, Simulation::Snapshot& snapshot);
+
+	Group& getGroup(size_t index) { return groups[(firstGroup + index) % GROUP_COUNT]; }
+
+	std::array<Group, GROUP_COUNT> groups;
+	size_t firstGroup; // Oldest group
+	size_t groupCount; // Groups in use
+	size_t size; // States stored
+	Simulation::Snapshot snapshot; // Scratch
+};
\ No newline at end of file
@@ -0,0 +1,154 @@
+// ================================================================================================
+// File: RotationSystem.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the RotationSystem class, which holds the wall kick tables of the Super
+//              Rotation System (SRS). When a rotation would collide, the tetromino is moved by each
+//              kick offset for its type and rotation transition in order, and the first offset that
+//              fits is used. The quarter-turn kicks are derived at compile time from the per-state
+//              SRS offset data (kick = offset of the old state - offset of the new state), and the
+//              half-turn kicks follow the widely used SRS+ table. All tables are constexpr, so a
+//              rotation attempt never allocates.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include "Tetromino.hpp"
+
+class RotationSystem
+{
+public:
+	static constexpr size_t MAX_KICK_TESTS = 6u;
+
+	// Offsets to try in order for a single rotation transition, in grid coordinates (y down)
+	struct KickTests
+	{
+		std::array<Vector2i, MAX_KICK_TESTS> offsets;
+		size_t count;
+	};
+
+	// Returns the rotation index reached by rotating from `rotation` in the given direction
+	static constexpr unsigned getTargetRotation(unsigned rotation, Tetromino::RotationDirection direction)
+	{
+		switch (direction)
+		{
+		case Tetromino::RotationDirection::Clockwise: return (rotation + 1) % Tetromino::ROTATION_COUNT;
+		case Tetromino::RotationDirection::CounterClockwise: return (rotation + 3) % Tetromino::ROTATION_COUNT;
+		case Tetromino::RotationDirection::Half: return (rotation + 2) % Tetromino::ROTATION_COUNT;
+		}
+		return rotation;
+	}
+
+	static const KickTests& getKickTests(Tetromino::Type type, unsigned rotation, Tetromino::RotationDirection direction)
+	{
+		return KICK_TABLES[getKickSet(type)][rotation][static_cast<size_t>(direction)];
+	}
+
+	enum KickSet { JLSTZ, I, O, KICK_SET_COUNT };
+	using KickTable = std::array<std::array<KickTests, Tetromino::ROTATION_DIRECTION_COUNT>, Tetromino::ROTATION_COUNT>;
+
+	// Kick tables indexed by [kick set][rotation][direction]
+	static const std::array<KickTable, KICK_SET_COUNT> KICK_TABLES;
+
+private:
+	static constexpr KickSet getKickSet(Tetromino::Type type)
+	{
+		if (type == Tetromino::Type::I)
+			return I;
+		else if (type == Tetromino::Type::O)
+			return O;
+		else
+			return JLSTZ;
+	}
+
+	// SRS offset data per rotation state (0, R, 2, L), y up as in the guideline
+	using Offsets = std::array<std::array<Vector2i, 5>, Tetromino::ROTATION_COUNT>;
+
+	static constexpr Offsets JLSTZ_OFFSETS =
+	{{
+		{{ { 0, 0 }, {  0, 0 }, {  0,  0 }, { 0, 0 }, {  0, 0 } }}, // 0
+		{{ { 0, 0 }, {  1, 0 }, {  1, -1 }, { 0, 2 }, {  1, 2 } }}, // R
+		{{ { 0, 0 }, {  0, 0 }, {  0,  0 }, { 0, 0 }, {  0, 0 } }}, // 2
+		{{ { 0, 0 }, { -1, 0 }, { -1, -1 }, { 0, 2 }, { -1, 2 } }}  // L
+	}};
+
+	static constexpr Offsets I_OFFSETS =
+	{{
+		{{ {  0, 0 }, { -1, 0 }, {  2, 0 }, { -1,  0 }, {  2,  0 } }}, // 0
+		{{ { -1, 0 }, {  0, 0 }, {  0, 0 }, {  0,  1 }, {  0, -2 } }}, // R
+		{{ { -1, 1 }, {  1, 1 }, { -2, 1 }, {  1,  0 }, { -2,  0 } }}, // 2
+		{{ {  0, 1 }, {  0, 1 }, {  0, 1 }, {  0, -1 }, {  0,  2 } }}  // L
+	}};
+
+	// Half-turn kicks per starting rotation state, y up
+	static constexpr std::array<std::array<Vector2i, MAX_KICK_TESTS>, Tetromino::ROTATION_COUNT> HALF_TURN_KICKS =
+	{{
+		{{ { 0, 0 }, {  0,  1 }, {  1,  1 }, { -1,  1 }, {  1, 0 }, { -1, 0 } }}, // 0 -> 2
+		{{ { 0, 0 }, {  1,  0 }, {  1,  2 }, {  1,  1 }, {  0, 2 }, {  0, 1 } }}, // R -> L
+		{{ { 0, 0 }, {  0, -1 }, { -1, -1 }, {  1, -1 }, { -1, 0 }, {  1, 0 } }}, // 2 -> 0
+		{{ { 0, 0 }, { -1,  0 }, { -1,  2 }, { -1,  1 }, {  0, 2 }, {  0, 1 } }}  // L -> R
+	}};
+
+	// Converts from the guideline's y-up convention to grid coordinates
+	static constexpr Vector2i toGrid(Vector2i offset) { return { offset.x, -offset.y }; }
+
+	static constexpr KickTests buildQuarterTurnKicks(const Offsets& offsets, unsigned from, unsigned to)
+	{
+		// The first test of the I offsets moves the rotation center, which the 4x4 box rotation
+		// already accounts for, so every test is taken relative to it
+		KickTests kicks{};
+		const Vector2i center = offsets[from][0] - offsets[to][0];
+		for (size_t i = 0; i < offsets[from].size(); ++i)
+			kicks.offsets[i] = toGrid(offsets[from][i] - offsets[to][i] - center);
+		kicks.count = offsets[from].size();
+		return kicks;
+	}
+
+	static constexpr KickTests buildHalfTurnKicks(unsigned from)
+	{
+		KickTests kicks{};
+		for (size_t i = 0; i < MAX_KICK_TESTS; ++i)
+			kicks.offsets[i] = toGrid(HALF_TURN_KICKS[from][i]);
+		kicks.count = MAX_KICK_TESTS;
+		return kicks;
+	}
+
+	static constexpr KickTable buildKickTable(KickSet kickSet)
+	{
+		KickTable table{};
+		for (unsigned rotation = 0; rotation < Tetromino::ROTATION_COUNT; ++rotation)
+		{
+			for (unsigned direction = 0; direction < Tetromino::ROTATION_DIRECTION_COUNT; ++direction)
+			{
+				auto rotationDirection = static_cast<Tetromino::RotationDirection>(direction);
+				KickTests& kicks = table[rotation][direction];
+
+				// The O tetromino looks the same in every rotation state and never kicks
+				if (kickSet == O)
+					kicks = { {}, 1u };
+				else if (rotationDirection == Tetromino::RotationDirection::Half)
+					kicks = buildHalfTurnKicks(rotation);
+				else
+					kicks = buildQuarterTurnKicks(kickSet == I ? I_OFFSETS : JLSTZ_OFFSETS, rotation, getTargetRotation(rotation, rotationDirection));
+			}
+		}
+		return table;
+	}
+};
+
+inline constexpr std::array<RotationSystem::KickTable, RotationSystem::KICK_SET_COUNT> RotationSystem::KICK_TABLES =
+{{
+	RotationSystem::buildKickTable(RotationSystem::JLSTZ),
+	RotationSystem::buildKickTable(RotationSystem::I),
+	RotationSystem::buildKickTable(RotationSystem::O)
+}};
+
+// Sanity checks against the published SRS kick tables (grid coordinates, y down)
+static_assert(RotationSystem::KICK_TABLES[RotationSystem::JLSTZ][0][0].offsets[2] == Vector2i{ -1, -1 }, "JLSTZ 0->R kick");
+static_assert(RotationSystem::KICK_TABLES[RotationSystem::JLSTZ][1][1].offsets[4] == Vector2i{ 1, -2 }, "JLSTZ R->0 kick");
+static_assert(RotationSystem::KICK_TABLES[RotationSystem::I][0][0].offsets[1] == Vector2i{ -2, 0 }, "I 0->R kick");
+static_assert(RotationSystem::KICK_TABLES[RotationSystem::I][0][0].offsets[4] == Vector2i{ 1, -2 }, "I 0->R kick");
+static_assert(RotationSystem::KICK_TABLES[RotationSystem::I][3][0].offsets[3] == Vector2i{ 1, 2 }, "I L->0 kick");
\ No newline at end of file
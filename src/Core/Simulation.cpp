@@ -0,0 +1,324 @@
+// ================================================================================================
+// File: Simulation.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include "Simulation.hpp"
+
+Simulation::Simulation() :
+	Simulation(std::random_device{}())
+{
+}
+
+Simulation::Simulation(std::uint32_t seed) :
+	generator(seed),
+	currentTetromino(generator.getNext()),
+	nextTetromino(generator.getNext()),
+	tetrominoMovementDelay(getMovementDelay(0u)),
+	tetrominoMovementTimer(0u),
+	hasTetrominoCollidedDownward(false),
+	score(0),
+	level(0),
+	totalLinesCleared(0),
+	lastLinesCleared(0),
+	areLinesFlashing(false),
+	lineFlashTimer(0u),
+	lineFlashPhaseTimer(0u),
+	lineFlashPhase(LineFlashPhase::None),
+	isSoftDropping(false),
+	softDropTimer(0u),
+	events(NONE)
+{
+}
+
+void Simulation::reset()
+{
+	generator.reset();
+	restart();
+}
+
+void Simulation::reset(std::uint32_t seed)
+{
+	generator.reset(seed);
+	restart();
+}
+
+void Simulation::reset(const Xoshiro128& rng)
+{
+	generator.reset(rng);
+	restart();
+}
+
+void Simulation::capture(Snapshot& snapshot) const
+{
+	snapshot.grid = grid;
+	snapshot.generator = generator;
+	snapshot.currentTetromino = currentTetromino;
+	snapshot.nextTetromino = nextTetromino;
+	snapshot.tetrominoMovementDelay = tetrominoMovementDelay;
+	snapshot.tetrominoMovementTimer = tetrominoMovementTimer;
+	snapshot.score = score;
+	snapshot.level = level;
+	snapshot.totalLinesCleared = totalLinesCleared;
+	snapshot.lastLinesCleared = lastLinesCleared;
+	snapshot.lineFlashTimer = lineFlashTimer;
+	snapshot.lineFlashPhaseTimer = lineFlashPhaseTimer;
+	snapshot.softDropTimer = softDropTimer;
+	snapshot.events = events;
+	snapshot.filledLines = {};
+	snapshot.filledLineCount = static_cast<std::uint8_t>(std::min(filledLines.size(), snapshot.filledLines.size()));
+	for (size_t i = 0; i < snapshot.filledLineCount; ++i)
+		snapshot.filledLines[i] = static_cast<std::uint8_t>(filledLines[i]);
+	snapshot.lineFlashPhase = lineFlashPhase;
+	snapshot.hasTetrominoCollidedDownward = hasTetrominoCollidedDownward;
+	snapshot.areLinesFlashing = areLinesFlashing;
+	snapshot.isSoftDropping = isSoftDropping;
+}
+
+void Simulation::restore(const Snapshot& snapshot)
+{
+	grid = snapshot.grid;
+	generator = snapshot.generator;
+	currentTetromino = snapshot.currentTetromino;
+	nextTetromino = snapshot.nextTetromino;
+	tetrominoMovementDelay = snapshot.tetrominoMovementDelay;
+	tetrominoMovementTimer = snapshot.tetrominoMovementTimer;
+	score = snapshot.score;
+	level = snapshot.level;
+	totalLinesCleared = snapshot.totalLinesCleared;
+	lastLinesCleared = snapshot.lastLinesCleared;
+	lineFlashTimer = snapshot.lineFlashTimer;
+	lineFlashPhaseTimer = snapshot.lineFlashPhaseTimer;
+	softDropTimer = snapshot.softDropTimer;
+	events = snapshot.events;
+	filledLines.assign(snapshot.filledLines.begin(), snapshot.filledLines.begin() + snapshot.filledLineCount);
+	lineFlashPhase = snapshot.lineFlashPhase;
+	hasTetrominoCollidedDownward = snapshot.hasTetrominoCollidedDownward;
+	areLinesFlashing = snapshot.areLinesFlashing;
+	isSoftDropping = snapshot.isSoftDropping;
+}
+
+void Simulation::restart()
+{
+	score = 0;
+	level = 0;
+	totalLinesCleared = 0;
+	lastLinesCleared = 0;
+	filledLines.clear();
+	tetrominoMovementDelay = getMovementDelay(0u);
+	tetrominoMovementTimer = 0u;
+	hasTetrominoCollidedDownward = false;
+	areLinesFlashing = false;
+	lineFlashTimer = 0u;
+	lineFlashPhaseTimer = 0u;
+	lineFlashPhase = LineFlashPhase::None;
+	isSoftDropping = false;
+	softDropTimer = 0u;
+	events = NONE;
+	grid.reset();
+	currentTetromino = generator.getNext();
+	nextTetromino = generator.getNext();
+}
+
+void Simulation::step(const Input& input)
+{
+	events = NONE;
+
+	if (isGameOver())
+		return;
+
+	if (!input.down)
+		softDropTimer = 0u;
+	isSoftDropping = input.down;
+
+	shiftTetromino(input.shift);
+	updateTetrominoMovement();
+
+	if (input.rotateCW)
+		currentTetromino.tryRotate(Tetromino::RotationDirection::Clockwise, grid);
+	if (input.rotateCCW)
+		currentTetromino.tryRotate(Tetromino::RotationDirection::CounterClockwise, grid);
+	if (input.rotate180)
+		currentTetromino.tryRotate(Tetromino::RotationDirection::Half, grid);
+
+	if (input.hardDrop)
+	{
+		dropTetromino();
+		hasTetrominoCollidedDownward = true;
+	}
+	// Under 20G gravity the tetromino sits on the stack at all times, it still locks only once
+	// the automatic movement fails to move it down
+	else if (isTwentyG())
+		dropTetromino();
+
+	if (hasTetrominoCollidedDownward)
+	{
+		lockTetromino();
+		events |= TETROMINO_LOCKED;
+		if (isGameOver())
+		{
+			events |= GAME_OVER;
+			return;
+		}
+
+		generateNextTetromino();
+		hasTetrominoCollidedDownward = false;
+		if (isTwentyG())
+		{
+			// Every tetromino gets the whole lock delay
+			dropTetromino();
+			tetrominoMovementTimer = 0u;
+		}
+
+		filledLines = grid.getFilledLines();
+		if (!filledLines.empty())
+		{
+			areLinesFlashing = true;
+			lineFlashPhase = LineFlashPhase::None;
+		}
+	}
+
+	updateFilledLines();
+}
+
+Tetromino Simulation::getGhostTetromino() const
+{
+	Tetromino ghost = currentTetromino;
+	ghost.position.y += grid.getDropDistance(ghost);
+	return ghost;
+}
+
+bool Simulation::isGameOver() const
+{
+	// The game is over as soon as anything is locked into the top row
+	return grid.getRows()[0] != Grid::EMPTY_ROW;
+}
+
+unsigned Simulation::getScoreWorth(unsigned linesCleared) const
+{
+	if (linesCleared < 1 || linesCleared > 4)
+		return 0;
+
+	return BASE_SCORES_PER_LINE.at(static_cast<size_t>(linesCleared - 1)) * (level + 1);
+}
+
+unsigned Simulation::getMovementDelay(unsigned level)
+{
+	// Under 20G the automatic movement never moves the tetromino, it only decides when it locks
+	if (level >= TWENTY_G_LEVEL)
+		return TWENTY_G_LOCK_DELAY;
+
+	const unsigned decrease = level * MOVEMENT_DELAY_DECREASE;
+	if (decrease >= BASE_MOVEMENT_DELAY - MINIMUM_MOVEMENT_DELAY)
+		return toTicks(MINIMUM_MOVEMENT_DELAY);
+	return toTicks(BASE_MOVEMENT_DELAY - decrease);
+}
+
+void Simulation::shiftTetromino(int columns)
+{
+	const Vector2i offset{ columns < 0 ? -1 : 1, 0 };
+	for (int i = 0; i < std::abs(columns); ++i)
+	{
+		if (!currentTetromino.tryMove(offset, grid))
+			break;
+		// Under 20G the tetromino falls into any gap it moves over
+		if (isTwentyG())
+			dropTetromino();
+	}
+}
+
+void Simulation::updateTetrominoMovement()
+{
+	/* SOFT DROP */
+	// Down moves the tetromino at once and then every SOFT_DROP_DELAY ticks while it's held
+	if (isSoftDropping)
+	{
+		if (softDropTimer == 0u && !currentTetromino.tryMove({ 0, 1 }, grid))
+			hasTetrominoCollidedDownward = true;
+		if (++softDropTimer >= SOFT_DROP_DELAY)
+			softDropTimer = 0u;
+	}
+
+	/* AUTOMATIC MOVEMENT */
+	// Move the tetromino down automatically every tetrominoMovementDelay ticks but only if Down is not held
+	else
+	{
+		++tetrominoMovementTimer;
+		if (tetrominoMovementTimer >= tetrominoMovementDelay)
+		{
+			tetrominoMovementTimer = 0u;
+
+			if (!currentTetromino.tryMove({ 0, 1 }, grid))
+				hasTetrominoCollidedDownward = true;
+		}
+	}
+}
+
+void Simulation::updateFilledLines()
+{
+	if (areLinesFlashing)
+	{
+		++lineFlashTimer;
+		++lineFlashPhaseTimer;
+
+		if (lineFlashPhaseTimer >= LINE_FLASH_INTERVAL)
+		{
+			lineFlashPhaseTimer = 0u;
+			lineFlashPhase = lineFlashPhase == LineFlashPhase::Hidden ? LineFlashPhase::Highlighted : LineFlashPhase::Hidden;
+		}
+
+		if (lineFlashTimer >= LINE_FLASH_DURATION)
+		{
+			areLinesFlashing = false;
+		}
+	}
+	if (!areLinesFlashing && !filledLines.empty())
+	{
+		unsigned previousLevel = level;
+
+		lineFlashTimer = 0u;
+		lineFlashPhaseTimer = 0u;
+		lineFlashPhase = LineFlashPhase::None;
+
+		lastLinesCleared = static_cast<unsigned>(filledLines.size());
+		score += getScoreWorth(lastLinesCleared);
+		totalLinesCleared += lastLinesCleared;
+		level = totalLinesCleared / LINES_PER_LEVEL;
+		tetrominoMovementDelay = getMovementDelay(level);
+
+		events |= LINES_CLEARED;
+		if (previousLevel != level)
+			events |= LEVEL_UP;
+
+		grid.clearFilledLinesAndPushDown(filledLines);
+		filledLines.clear();
+	}
+}
+
+void Simulation::dropTetromino()
+{
+	currentTetromino.position.y += grid.getDropDistance(currentTetromino);
+}
+
+void Simulation::lockTetromino()
+{
+	// Cells still above the grid are dropped, a tetromino can only lock there on top of a filled
+	// top row, which ends the game anyway
+	for (const auto& cell : currentTetromino.getCells())
+		if (currentTetromino.position.y + cell.y >= 0)
+			grid.fillCell(currentTetromino.position + cell, currentTetromino.getType());
+}
+
+void Simulation::generateNextTetromino()
+{
+	currentTetromino = nextTetromino;
+	currentTetromino.updateStartPosition();
+	nextTetromino = generator.getNext();
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+// ================================================================================================
+// File: Simulation.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the Simulation class, which contains the rules of a single game of Tetris
+//              (gravity, movement, rotation, locking, line clears, scoring and levels) without any
+//              dependency on SFML. The game is advanced one fixed time step at a time by calling
+//              step() with the player input for that tick, and its state can be queried in between.
+//              Anything the presentation layer needs to react to (sounds, HUD updates) is reported
+//              through the events raised by the last step. All timing is counted in whole ticks, so
+//              a game is fully determined by its seed and the input of every tick. The whole state
+//              can be captured into a Snapshot of plain data and restored from it, e.g. to rewind.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <type_traits>
+#include "Grid.hpp"
+#include "TetrominoGenerator.hpp"
+
+class Simulation
+{
+public:
+	static constexpr unsigned TICKS_PER_SECOND = 60u;
+	static constexpr float TIME_STEP = 1.f / TICKS_PER_SECOND; // Fixed time step of a single tick
+	static constexpr unsigned TWENTY_G_LEVEL = 20U; // From this level on, tetrominoes fall to the bottom at once
+
+	// Player input for a single tick
+	struct Input
+	{
+		std::int8_t shift = 0; // Columns to move sideways this tick, negative to the left; auto-repeat is up to the caller
+		bool down = false;   // Down is held
+		bool rotateCW = false;  // Clockwise rotation was requested since the last tick
+		bool rotateCCW = false; // Counter-clockwise rotation was requested since the last tick
+		bool rotate180 = false; // Half-turn rotation was requested since the last tick
+		bool hardDrop = false;  // Hard drop was requested since the last tick
+	};
+
+	// Events raised during the last step, combined as bit flags
+	enum Event : unsigned
+	{
+		NONE = 0u,
+		TETROMINO_LOCKED = 1u << 0,
+		LINES_CLEARED = 1u << 1,
+		LEVEL_UP = 1u << 2,
+		GAME_OVER = 1u << 3
+	};
+
+	// State of the flash animation played on filled lines before they are cleared
+	enum class LineFlashPhase
+	{
+		None,
+		Hidden,
+		Highlighted
+	};
+
+	// Complete state of a game between two steps, as plain data that can be copied and compared
+	// byte by byte
+	struct Snapshot
+	{
+		Grid grid;
+		TetrominoGenerator generator;
+		Tetromino currentTetromino;
+		Tetromino nextTetromino;
+		unsigned tetrominoMovementDelay;
+		unsigned tetrominoMovementTimer;
+		unsigned score;
+		unsigned level;
+		unsigned totalLinesCleared;
+		unsigned lastLinesCleared;
+		unsigned lineFlashTimer;
+		unsigned lineFlashPhaseTimer;
+		unsigned softDropTimer;
+		unsigned events;
+		std::array<std::uint8_t, 4> filledLines; // A tetromino can't fill more than 4 lines
+		std::uint8_t filledLineCount;
+		LineFlashPhase lineFlashPhase;
+		bool hasTetrominoCollidedDownward;
+		bool areLinesFlashing;
+		bool isSoftDropping;
+	};
+
+	Simulation();
+	// Games created with the same seed get the same tetromino sequence
+	explicit Simulation(std::uint32_t seed);
+	void reset();
+	void reset(std::uint32_t seed);
+	// Restart with the tetromino sequence of the given random number generator, e.g. one of the
+	// non-overlapping streams jumped apart for parallel games
+	void reset(const Xoshiro128& rng);
+
+	// Advance the game by a single fixed time step
+	void step(const Input& input);
+
+	void capture(Snapshot& snapshot) const;
+	// Continue from a captured state, including the events raised by the step that led to it
+	void restore(const Snapshot& snapshot);
+
+	const Grid& getGrid() const { return grid; }
+	const Tetromino& getCurrentTetromino() const { return currentTetromino; }
+	const Tetromino& getNextTetromino() const { return nextTetromino; }
+	// The current tetromino moved down to where it would land, for the ghost piece
+	Tetromino getGhostTetromino() const;
+	// Tetrominoes queued after the next one, for longer previews and lookahead
+	const TetrominoGenerator& getGenerator() const { return generator; }
+
+	unsigned getScore() const { return score; }
+	unsigned getLevel() const { return level; }
+	unsigned getTotalLinesCleared() const { return totalLinesCleared; }
+	// Number of lines cleared by the last step, only meaningful if LINES_CLEARED was raised
+	unsigned getLastLinesCleared() const { return lastLinesCleared; }
+
+	const std::vector<unsigned>& getFilledLines() const { return filledLines; }
+	LineFlashPhase getLineFlashPhase() const { return lineFlashPhase; }
+
+	bool hasEvent(Event event) const { return (events & event) != 0u; }
+	unsigned getEvents() const { return events; }
+
+	bool isGameOver() const;
+	bool isTwentyG() const { return level >= TWENTY_G_LEVEL; }
+
+private:
+	// Reset everything but the tetromino generator and deal the first tetrominoes
+	void restart();
+	// Calculate score based on the number of lines just cleared and the current level and return it as an unsigned
+	unsigned getScoreWorth(unsigned linesCleared) const;
+
+	// Move the tetromino sideways one column at a time, stopping at the first obstacle
+	void shiftTetromino(int columns);
+	// Update the tetromino movement based on soft drop and automatic movement
+	void updateTetrominoMovement();
+	// Update the flash animation of the filled lines and clear them once it's done
+	void updateFilledLines();
+	// Move the current tetromino straight down to where it lands
+	void dropTetromino();
+	// Lock the tetromino in place
+	void lockTetromino();
+	// Generate the next tetromino
+	void generateNextTetromino();
+
+	// Number of whole ticks that last at least the given number of milliseconds
+	static constexpr unsigned toTicks(unsigned milliseconds) { return (milliseconds * TICKS_PER_SECOND + 999u) / 1000u; }
+	// Delay between automatic tetromino movements at the given level, in ticks
+	static unsigned getMovementDelay(unsigned level);
+
+	static constexpr unsigned LINES_PER_LEVEL = 10U; // Number of lines to clear to level up
+	static constexpr unsigned BASE_MOVEMENT_DELAY = 1000U; // Base delay between automatic tetromino movements in milliseconds
+	static constexpr unsigned MINIMUM_MOVEMENT_DELAY = 100U; // Minimum delay between automatic tetromino movements in milliseconds
+	static constexpr unsigned MOVEMENT_DELAY_DECREASE = 120U; // Movement delay decrease per level in milliseconds
+	static constexpr unsigned TWENTY_G_LOCK_DELAY = 30U; // Ticks a tetromino can rest on the stack under 20G before it locks (0.5 s)
+	static constexpr unsigned LINE_FLASH_DURATION = 24U; // Ticks for flashing filled lines (0.4 s)
+	static constexpr unsigned LINE_FLASH_INTERVAL = 6U; // Ticks between flashes (0.1 s)
+	static constexpr unsigned SOFT_DROP_DELAY = 3U; // Ticks between soft drop movements while Down is held (0.05 s)
+
+	// Score per line cleared in a single move
+	static constexpr std::array<unsigned, 4> BASE_SCORES_PER_LINE =
+	{{
+		{ 40U },  // 1 line cleared
+		{ 100U }, // 2 lines cleared
+		{ 300U }, // 3 lines cleared
+		{ 1200U } // 4 lines cleared
+	}};
+
+	Grid grid;
+
+	TetrominoGenerator generator;
+	Tetromino currentTetromino, nextTetromino;
+	unsigned tetrominoMovementDelay; // Ticks between automatic tetromino movements
+	unsigned tetrominoMovementTimer; // Ticks since the last automatic tetromino movement
+	bool hasTetrominoCollidedDownward;
+
+	unsigned score;
+	unsigned level;
+	unsigned totalLinesCleared;
+	unsigned lastLinesCleared;
+
+	std::vector<unsigned> filledLines; // Lines that are filled and need to be cleared
+	bool areLinesFlashing;
+	unsigned lineFlashTimer; // Ticks the filled lines have been flashing for
+	unsigned lineFlashPhaseTimer;
+	LineFlashPhase lineFlashPhase;
+
+	bool isSoftDropping; // Down is held
+	unsigned softDropTimer; // Ticks since the last soft drop movement
+
+	unsigned events;
+};
+
+static_assert(std::is_trivially_copyable_v<Simulation::Snapshot>, "Snapshots must stay plain data so they can be stored byte by byte");
\ No newline at end of file
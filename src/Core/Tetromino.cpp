@@ -0,0 +1,64 @@
+// ================================================================================================
+// File: Tetromino.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 8, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include "Tetromino.hpp"
+#include "RotationSystem.hpp"
+#include "Grid.hpp"
+
+Tetromino::Tetromino(Tetromino::Type type) :
+	type(type)
+{
+	updateStartPosition();
+}
+
+void Tetromino::updateStartPosition()
+{
+	if (this->type == Type::I)
+		position = START_POSITION + Vector2i{ 0, -1 };
+	else if (this->type == Type::O)
+		position = START_POSITION + Vector2i{ 1, 0 };
+	else
+		position = START_POSITION;
+}
+
+bool Tetromino::tryMove(Vector2i offset, const Grid& grid)
+{
+	position += offset;
+	if (isAtValidPosition(grid))
+		return true;
+	position -= offset;
+	return false;
+}
+
+bool Tetromino::tryRotate(RotationDirection direction, const Grid& grid)
+{
+	const std::uint8_t originalRotation = rotation;
+	const Vector2i originalPosition = position;
+	const RotationSystem::KickTests& kicks = RotationSystem::getKickTests(type, rotation, direction);
+
+	rotation = static_cast<std::uint8_t>(RotationSystem::getTargetRotation(rotation, direction));
+
+	// Try each wall kick in order and keep the first one that fits
+	for (size_t i = 0; i < kicks.count; ++i)
+	{
+		position = originalPosition + kicks.offsets[i];
+		if (isAtValidPosition(grid))
+			return true;
+	}
+
+	// If all attempts fail, revert to the original rotation and position
+	rotation = originalRotation;
+	position = originalPosition;
+	return false;
+}
+
+bool Tetromino::isAtValidPosition(const Grid& grid) const
+{
+	return !grid.doesCollide(getRowMasks(), position);
+}
\ No newline at end of file
@@ -0,0 +1,205 @@
+// ================================================================================================
+// File: Tetromino.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 8, 2025
+// Description: Defines the Tetromino class, which represents a Tetris piece. A tetromino is a
+//              small value type made of its type, rotation index and position in the grid. The
+//              shapes of every rotation of every type are computed at compile time into a single
+//              shared table, so tetrominoes are trivially copyable and cheap to compare and hash.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include "Vector2.hpp"
+
+class Grid;
+
+class Tetromino
+{
+public:
+	static constexpr Vector2i START_POSITION = { 3, -1 };
+
+	enum class Type : std::uint8_t { I, O, T, S, Z, J, L };
+	static constexpr unsigned TYPE_COUNT = 7u;
+	static constexpr unsigned ROTATION_COUNT = 4u;
+
+	enum class RotationDirection : std::uint8_t { Clockwise, CounterClockwise, Half };
+	static constexpr unsigned ROTATION_DIRECTION_COUNT = 3u;
+
+	using Shape = std::array<std::array<bool, 4>, 4>;
+	// One bit mask per shape row, bit x set if column x of the row is filled
+	using RowMasks = std::array<std::uint16_t, 4>;
+	// Positions of the four filled cells, relative to the top-left corner of the shape
+	using Cells = std::array<Vector2i, 4>;
+
+	// A single rotation state of a tetromino type
+	struct Orientation
+	{
+		RowMasks rowMasks;
+		Cells cells;
+		std::array<std::int8_t, 4> columnBottoms; // Lowest filled row of each shape column, -1 if the column is empty
+	};
+
+	Tetromino() = default;
+	Tetromino(Type type);
+
+	// Update tetromino start position based on its type
+	void updateStartPosition();
+
+	// Try and move the tetromino by the given offset, returning true if successful
+	bool tryMove(Vector2i offset, const Grid& grid);
+	// Try and rotate the tetromino in the given direction using the SRS wall kicks, returning true if successful
+	bool tryRotate(RotationDirection direction, const Grid& grid);
+
+	bool isAtValidPosition(const Grid& grid) const;
+
+	const Orientation& getOrientation() const { return ORIENTATIONS[static_cast<size_t>(type)][rotation]; }
+	const RowMasks& getRowMasks() const { return getOrientation().rowMasks; }
+	const Cells& getCells() const { return getOrientation().cells; }
+	Type getType() const { return type; }
+	unsigned getRotation() const { return rotation; }
+
+	bool operator==(const Tetromino& other) const { return type == other.type && rotation == other.rotation && position == other.position; }
+	bool operator!=(const Tetromino& other) const { return !(*this == other); }
+
+	// Every rotation state of every tetromino type, indexed by [type][rotation]
+	static const std::array<std::array<Orientation, ROTATION_COUNT>, TYPE_COUNT> ORIENTATIONS;
+
+	Vector2i position; // Top-left corner of the tetromino in the grid
+
+private:
+	static constexpr std::array<Shape, TYPE_COUNT> SHAPES =
+	{{
+		// I
+		{{
+			{ 0, 0, 0, 0 },
+			{ 1, 1, 1, 1 },
+			{ 0, 0, 0, 0 },
+			{ 0, 0, 0, 0 }
+		}},
+		// O
+		{{
+			{ 1, 1, 0, 0 },
+			{ 1, 1, 0, 0 },
+			{ 0, 0, 0, 0 },
+			{ 0, 0, 0, 0 }
+		}},
+		// T
+		{{
+			{ 0, 1, 0, 0 },
+			{ 1, 1, 1, 0 },
+			{ 0, 0, 0, 0 },
+			{ 0, 0, 0, 0 }
+		}},
+		// S
+		{{
+			{ 0, 1, 1, 0 },
+			{ 1, 1, 0, 0 },
+			{ 0, 0, 0, 0 },
+			{ 0, 0, 0, 0 }
+		}},
+		// Z
+		{{
+			{ 1, 1, 0, 0 },
+			{ 0, 1, 1, 0 },
+			{ 0, 0, 0, 0 },
+			{ 0, 0, 0, 0 }
+		}},
+		// J
+		{{
+			{ 1, 0, 0, 0 },
+			{ 1, 1, 1, 0 },
+			{ 0, 0, 0, 0 },
+			{ 0, 0, 0, 0 }
+		}},
+		// L
+		{{
+			{ 0, 0, 1, 0 },
+			{ 1, 1, 1, 0 },
+			{ 0, 0, 0, 0 },
+			{ 0, 0, 0, 0 }
+		}}
+	}};
+
+	// Rotate a shape of the given type clockwise inside its SRS bounding box
+	static constexpr Shape rotateCW(const Shape& shape, Type type)
+	{
+		// O tetromino does not change shape when rotated
+		if (type == Type::O)
+			return shape;
+
+		// I tetromino rotates inside a 4x4 box, all other tetrominoes inside the top-left 3x3 box
+		const size_t size = type == Type::I ? 4 : 3;
+
+		Shape rotatedShape{};
+		for (size_t y = 0; y < size; ++y)
+			for (size_t x = 0; x < size; ++x)
+				rotatedShape[x][size - 1 - y] = shape[y][x];
+		return rotatedShape;
+	}
+
+	static constexpr Orientation toOrientation(const Shape& shape)
+	{
+		Orientation orientation{};
+		orientation.columnBottoms = { -1, -1, -1, -1 };
+		size_t i = 0;
+		for (size_t y = 0; y < 4; ++y)
+		{
+			for (size_t x = 0; x < 4; ++x)
+			{
+				if (shape[y][x])
+				{
+					orientation.rowMasks[y] |= static_cast<std::uint16_t>(1u << x);
+					orientation.cells[i++] = { static_cast<int>(x), static_cast<int>(y) };
+					orientation.columnBottoms[x] = static_cast<std::int8_t>(y);
+				}
+			}
+		}
+		return orientation;
+	}
+
+	static constexpr std::array<std::array<Orientation, ROTATION_COUNT>, TYPE_COUNT> buildOrientations()
+	{
+		std::array<std::array<Orientation, ROTATION_COUNT>, TYPE_COUNT> orientations{};
+		for (size_t type = 0; type < TYPE_COUNT; ++type)
+		{
+			Shape shape = SHAPES[type];
+			for (size_t rotation = 0; rotation < ROTATION_COUNT; ++rotation)
+			{
+				orientations[type][rotation] = toOrientation(shape);
+				shape = rotateCW(shape, static_cast<Type>(type));
+			}
+		}
+		return orientations;
+	}
+
+	Type type = Type::I;
+	std::uint8_t rotation = 0;
+};
+
+inline constexpr std::array<std::array<Tetromino::Orientation, Tetromino::ROTATION_COUNT>, Tetromino::TYPE_COUNT> Tetromino::ORIENTATIONS = Tetromino::buildOrientations();
+
+static_assert(std::is_trivially_copyable_v<Tetromino>, "Tetromino must stay a plain value type");
+
+namespace std
+{
+	template<>
+	struct hash<Tetromino>
+	{
+		size_t operator()(const Tetromino& tetromino) const noexcept
+		{
+			return static_cast<size_t>(tetromino.getType()) |
+				(static_cast<size_t>(tetromino.getRotation()) << 3) |
+				(static_cast<size_t>(static_cast<std::uint8_t>(tetromino.position.x)) << 8) |
+				(static_cast<size_t>(static_cast<std::uint8_t>(tetromino.position.y)) << 16);
+		}
+	};
+}
\ No newline at end of file
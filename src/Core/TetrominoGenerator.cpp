@@ -0,0 +1,133 @@
+// ================================================================================================
+// File: TetrominoGenerator.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 8, 2025
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include "TetrominoGenerator.hpp"
+
+template <size_t COPIES>
+void BagRandomizer<COPIES>::reset()
+{
+	remaining = 0u;
+}
+
+template <size_t COPIES>
+Tetromino::Type BagRandomizer<COPIES>::next(Xoshiro128& rng)
+{
+	if (remaining == 0u)
+	{
+		for (size_t i = 0; i < bag.size(); ++i)
+			bag[i] = static_cast<Tetromino::Type>(i % Tetromino::TYPE_COUNT);
+		remaining = bag.size();
+	}
+
+	// One step of a Fisher-Yates shuffle per tetromino, so the bag is never shuffled all at once
+	const size_t index = rng.nextBelow(static_cast<std::uint32_t>(remaining));
+	--remaining;
+	std::swap(bag[index], bag[remaining]);
+	return bag[remaining];
+}
+
+void HistoryRandomizer::reset()
+{
+	history.fill(Tetromino::Type::Z);
+	isFirst = true;
+}
+
+Tetromino::Type HistoryRandomizer::next(Xoshiro128& rng)
+{
+	Tetromino::Type type = Tetromino::Type::I;
+	if (isFirst)
+	{
+		// The first tetromino is never S, Z or O, so the game doesn't start with an overhang
+		static constexpr std::array<Tetromino::Type, 4> FIRST_TYPES = { Tetromino::Type::I, Tetromino::Type::J, Tetromino::Type::L, Tetromino::Type::T };
+		type = FIRST_TYPES[rng.nextBelow(static_cast<std::uint32_t>(FIRST_TYPES.size()))];
+		isFirst = false;
+	}
+	else
+	{
+		for (unsigned roll = 0; roll < ROLL_COUNT; ++roll)
+		{
+			type = static_cast<Tetromino::Type>(rng.nextBelow(Tetromino::TYPE_COUNT));
+			if (std::find(history.begin(), history.end(), type) == history.end())
+				break;
+		}
+	}
+
+	std::rotate(history.begin(), history.begin() + 1, history.end());
+	history.back() = type;
+	return type;
+}
+
+Tetromino::Type PureRandomizer::next(Xoshiro128& rng)
+{
+	return static_cast<Tetromino::Type>(rng.nextBelow(Tetromino::TYPE_COUNT));
+}
+
+template <class Randomizer>
+BasicTetrominoGenerator<Randomizer>::BasicTetrominoGenerator() :
+	BasicTetrominoGenerator(std::random_device{}())
+{
+}
+
+template <class Randomizer>
+BasicTetrominoGenerator<Randomizer>::BasicTetrominoGenerator(std::uint32_t seed) :
+	rng(seed)
+{
+	reset();
+}
+
+template <class Randomizer>
+BasicTetrominoGenerator<Randomizer>::BasicTetrominoGenerator(const Xoshiro128& rng) :
+	rng(rng)
+{
+	reset();
+}
+
+template <class Randomizer>
+void BasicTetrominoGenerator<Randomizer>::reset()
+{
+	randomizer.reset();
+	for (Tetromino::Type& type : queue)
+		type = randomizer.next(rng);
+	head = 0u;
+}
+
+template <class Randomizer>
+void BasicTetrominoGenerator<Randomizer>::reset(std::uint32_t seed)
+{
+	rng.seed(seed);
+	reset();
+}
+
+template <class Randomizer>
+void BasicTetrominoGenerator<Randomizer>::reset(const Xoshiro128& rng)
+{
+	this->rng = rng;
+	reset();
+}
+
+template <class Randomizer>
+Tetromino::Type BasicTetrominoGenerator<Randomizer>::getNext()
+{
+	// The dealt slot is refilled right away, so the queue is always full
+	const Tetromino::Type next = queue[head];
+	queue[head] = randomizer.next(rng);
+	head = (head + 1u) & (QUEUE_SIZE - 1u);
+	return next;
+}
+
+template class BagRandomizer<1u>;
+template class BagRandomizer<2u>;
+
+template class BasicTetrominoGenerator<SevenBagRandomizer>;
+template class BasicTetrominoGenerator<FourteenBagRandomizer>;
+template class BasicTetrominoGenerator<HistoryRandomizer>;
+template class BasicTetrominoGenerator<PureRandomizer>;
\ No newline at end of file
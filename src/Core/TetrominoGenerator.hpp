@@ -0,0 +1,101 @@
+// ================================================================================================
+// File: TetrominoGenerator.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: May 8, 2025
+// Description: Defines the TetrominoGenerator class, which is responsible for generating random tetrominoes.
+//              The order of the tetrominoes is decided by a randomizer policy given as a template
+//              parameter, so the default 7-bag is called directly without any virtual calls:
+//              - SevenBagRandomizer deals all 7 shapes in a random order before any are repeated
+//              - FourteenBagRandomizer does the same with two of every shape
+//              - HistoryRandomizer rerolls shapes that were dealt recently, like the arcade TGM
+//              - PureRandomizer picks every shape independently
+//              The upcoming tetrominoes are kept in a fixed-size ring buffer that is always full, so
+//              any of them can be peeked at without generating anything or allocating. Generators
+//              created with the same seed give the same sequence. Parallel simulations can instead
+//              be given random number generators jumped apart from one seed, whose sequences never
+//              overlap.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "Tetromino.hpp"
+#include "Xoshiro128.hpp"
+
+// Shuffled bag holding COPIES of every shape, refilled once it's empty
+template <size_t COPIES>
+class BagRandomizer
+{
+public:
+	void reset();
+	Tetromino::Type next(Xoshiro128& rng);
+
+private:
+	std::array<Tetromino::Type, COPIES * Tetromino::TYPE_COUNT> bag;
+	size_t remaining = 0u;
+};
+
+using SevenBagRandomizer = BagRandomizer<1u>;
+using FourteenBagRandomizer = BagRandomizer<2u>;
+
+// Rolls up to ROLL_COUNT times for a shape that isn't among the last 4 dealt (TGM1 rules)
+class HistoryRandomizer
+{
+public:
+	void reset();
+	Tetromino::Type next(Xoshiro128& rng);
+
+private:
+	static constexpr unsigned ROLL_COUNT = 4u;
+
+	std::array<Tetromino::Type, 4> history;
+	bool isFirst = true;
+};
+
+class PureRandomizer
+{
+public:
+	void reset() {}
+	Tetromino::Type next(Xoshiro128& rng);
+};
+
+template <class Randomizer>
+class BasicTetrominoGenerator
+{
+public:
+	static constexpr size_t QUEUE_SIZE = 8u; // Number of upcoming tetrominoes that can be peeked at
+
+	BasicTetrominoGenerator();
+	explicit BasicTetrominoGenerator(std::uint32_t seed);
+	explicit BasicTetrominoGenerator(const Xoshiro128& rng);
+	void reset();
+	// Restart the sequence from the given seed
+	void reset(std::uint32_t seed);
+	// Restart the sequence from the given state of the random number generator
+	void reset(const Xoshiro128& rng);
+
+	Tetromino::Type getNext();
+	// Tetromino that the (n + 1)th call to getNext() will return, for n < QUEUE_SIZE
+	Tetromino::Type peek(size_t n) const { return queue[(head + n) & (QUEUE_SIZE - 1u)]; }
+
+private:
+	static_assert((QUEUE_SIZE & (QUEUE_SIZE - 1u)) == 0u, "The queue size must be a power of two");
+
+	Xoshiro128 rng;
+	Randomizer randomizer;
+	std::array<Tetromino::Type, QUEUE_SIZE> queue;
+	size_t head;
+};
+
+extern template class BagRandomizer<1u>;
+extern template class BagRandomizer<2u>;
+extern template class BasicTetrominoGenerator<SevenBagRandomizer>;
+extern template class BasicTetrominoGenerator<FourteenBagRandomizer>;
+extern template class BasicTetrominoGenerator<HistoryRandomizer>;
+extern template class BasicTetrominoGenerator<PureRandomizer>;
+
+using TetrominoGenerator = BasicTetrominoGenerator<SevenBagRandomizer>;
\ No newline at end of file
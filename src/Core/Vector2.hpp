@@ -0,0 +1,25 @@
+// ================================================================================================
+// File: Vector2.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the Vector2i struct, a minimal integer 2D vector used by the core game
+//              logic in place of SFML's vector types, so the rules can be built without SFML.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+struct Vector2i
+{
+	int x = 0;
+	int y = 0;
+
+	constexpr Vector2i operator+(Vector2i other) const { return { x + other.x, y + other.y }; }
+	constexpr Vector2i operator-(Vector2i other) const { return { x - other.x, y - other.y }; }
+	constexpr Vector2i& operator+=(Vector2i other) { x += other.x; y += other.y; return *this; }
+	constexpr Vector2i& operator-=(Vector2i other) { x -= other.x; y -= other.y; return *this; }
+	constexpr bool operator==(Vector2i other) const { return x == other.x && y == other.y; }
+	constexpr bool operator!=(Vector2i other) const { return !(*this == other); }
+};
\ No newline at end of file
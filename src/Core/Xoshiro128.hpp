@@ -0,0 +1,104 @@
+// ================================================================================================
+// File: Xoshiro128.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the Xoshiro128 class, a small and fast seedable random number generator
+//              (xoshiro128** by Blackman and Vigna) with 16 bytes of state. It meets the uniform
+//              random bit generator requirements, so it works with the standard distributions, and
+//              it can jump 2^64 numbers ahead, which splits a single seed into as many independent,
+//              non-overlapping streams as there are parallel simulations.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+class Xoshiro128
+{
+public:
+	using result_type = std::uint32_t;
+
+	static constexpr result_type min() { return 0u; }
+	static constexpr result_type max() { return UINT32_MAX; }
+
+	explicit Xoshiro128(std::uint64_t seed = 0u) { this->seed(seed); }
+
+	void seed(std::uint64_t seed)
+	{
+		// The state is filled with SplitMix64, so similar seeds still give unrelated streams and
+		// the state is never all zeros
+		for (size_t i = 0; i < state.size(); i += 2)
+		{
+			seed += 0x9E3779B97F4A7C15ull;
+			std::uint64_t z = seed;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			z ^= z >> 31;
+			state[i] = static_cast<std::uint32_t>(z);
+			state[i + 1] = static_cast<std::uint32_t>(z >> 32);
+		}
+	}
+
+	result_type operator()()
+	{
+		const std::uint32_t result = rotateLeft(state[1] * 5u, 7) * 9u;
+		const std::uint32_t t = state[1] << 9;
+
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= t;
+		state[3] = rotateLeft(state[3], 11);
+
+		return result;
+	}
+
+	// Uniform number in [0, bound) without modulo bias (Lemire's multiply and reject)
+	std::uint32_t nextBelow(std::uint32_t bound)
+	{
+		std::uint64_t product = static_cast<std::uint64_t>((*this)()) * bound;
+		std::uint32_t low = static_cast<std::uint32_t>(product);
+		if (low < bound)
+		{
+			const std::uint32_t threshold = static_cast<std::uint32_t>(-bound) % bound;
+			while (low < threshold)
+			{
+				product = static_cast<std::uint64_t>((*this)()) * bound;
+				low = static_cast<std::uint32_t>(product);
+			}
+		}
+		return static_cast<std::uint32_t>(product >> 32);
+	}
+
+	// Advance the generator as if it was called 2^64 times
+	void jump()
+	{
+		static constexpr std::array<std::uint32_t, 4> JUMP = { 0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu };
+
+		std::array<std::uint32_t, 4> jumped{};
+		for (std::uint32_t word : JUMP)
+		{
+			for (unsigned bit = 0; bit < 32u; ++bit)
+			{
+				if (word & (1u << bit))
+					for (size_t i = 0; i < state.size(); ++i)
+						jumped[i] ^= state[i];
+				(*this)();
+			}
+		}
+		state = jumped;
+	}
+
+private:
+	static constexpr std::uint32_t rotateLeft(std::uint32_t value, int count)
+	{
+		return (value << count) | (value >> (32 - count));
+	}
+
+	std::array<std::uint32_t, 4> state;
+};
\ No newline at end of file
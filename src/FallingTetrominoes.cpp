@@ -0,0 +1,103 @@
+// ================================================================================================
+// File: FallingTetrominoes.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include "FallingTetrominoes.hpp"
+#include "BoardRenderer.hpp"
+
+FallingTetrominoes::FallingTetrominoes(sf::Vector2f areaSize, size_t count) :
+	areaSize(areaSize),
+	lastTimeStep(0.f),
+	positionsX(count),
+	positionsY(count),
+	speeds(count),
+	cellSizes(count),
+	types(count),
+	rotations(count),
+	vertices(sf::VertexBuffer::Usage::Stream),
+	rng(std::random_device{}())
+{
+	vertices.resize(count * VERTICES_PER_TETROMINO);
+	for (size_t i = 0; i < count; ++i)
+	{
+		spawn(i, false);
+		writeTetromino(i, 0.f);
+	}
+	vertices.upload();
+}
+
+void FallingTetrominoes::update(float fixedTimeStep)
+{
+	const size_t count = positionsY.size();
+
+	for (size_t i = 0; i < count; ++i)
+		positionsY[i] += speeds[i] * fixedTimeStep;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (positionsY[i] > areaSize.y)
+			spawn(i, true);
+	}
+	lastTimeStep = fixedTimeStep;
+}
+
+void FallingTetrominoes::interpolate(float alpha)
+{
+	// The pieces fall in straight lines, so the position between the last two ticks is the last one
+	// moved back; a respawned piece starts above the area either way
+	const float rewind = lastTimeStep * (1.f - std::clamp(alpha, 0.f, 1.f));
+	for (size_t i = 0; i < positionsY.size(); ++i)
+		writeTetromino(i, -speeds[i] * rewind);
+	vertices.upload();
+}
+
+void FallingTetrominoes::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	target.draw(vertices, states);
+}
+
+void FallingTetrominoes::spawn(size_t index, bool isRespawn)
+{
+	std::uniform_real_distribution<float> depthDistribution(0.f, 1.f);
+	std::uniform_int_distribution<int> typeDistribution(0, Tetromino::TYPE_COUNT - 1);
+	std::uniform_int_distribution<int> rotationDistribution(0, Tetromino::ROTATION_COUNT - 1);
+
+	// Nearer pieces are bigger and fall faster. Depth grows with the index so the pieces are drawn
+	// from the farthest to the nearest.
+	const float depth = (index + depthDistribution(rng)) / positionsY.size();
+	cellSizes[index] = MIN_CELL_SIZE + depth * (MAX_CELL_SIZE - MIN_CELL_SIZE);
+	speeds[index] = MIN_SPEED + depth * (MAX_SPEED - MIN_SPEED);
+	types[index] = static_cast<Tetromino::Type>(typeDistribution(rng));
+	rotations[index] = static_cast<std::uint8_t>(rotationDistribution(rng));
+
+	const float pieceSize = 4.f * cellSizes[index];
+	std::uniform_real_distribution<float> xDistribution(-pieceSize, areaSize.x);
+	positionsX[index] = xDistribution(rng);
+
+	// The first pieces are spread over the whole area so the screen doesn't start empty
+	std::uniform_real_distribution<float> yDistribution(-pieceSize - (isRespawn ? areaSize.y * 0.25f : areaSize.y), -pieceSize);
+	positionsY[index] = isRespawn ? yDistribution(rng) : yDistribution(rng) + areaSize.y;
+}
+
+void FallingTetrominoes::writeTetromino(size_t index, float offsetY)
+{
+	const Tetromino::Orientation& orientation = Tetromino::ORIENTATIONS[static_cast<size_t>(types[index])][rotations[index]];
+	const float cellSize = cellSizes[index];
+
+	// Farther pieces are dimmer
+	sf::Color color = BoardRenderer::getColor(types[index]);
+	color.a = static_cast<std::uint8_t>(30.f + 60.f * (cellSize - MIN_CELL_SIZE) / (MAX_CELL_SIZE - MIN_CELL_SIZE));
+
+	const size_t first = index * VERTICES_PER_TETROMINO;
+	for (size_t i = 0; i < orientation.cells.size(); ++i)
+	{
+		const sf::Vector2f position(positionsX[index] + orientation.cells[i].x * cellSize, positionsY[index] + offsetY + orientation.cells[i].y * cellSize);
+		vertices.writeQuad(first + i * VertexLayer::VERTICES_PER_QUAD, position, { cellSize - 1.f, cellSize - 1.f }, color);
+	}
+}
\ No newline at end of file
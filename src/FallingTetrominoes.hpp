@@ -0,0 +1,58 @@
+// ================================================================================================
+// File: FallingTetrominoes.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the FallingTetrominoes class, the animated background of the title screen:
+//              a few hundred tetrominoes of different sizes falling at different speeds. The pieces
+//              are stored as a structure of arrays so the per-tick update runs over tightly packed
+//              floats, and all of them are written into one vertex layer drawn with a single call.
+//              The pieces are written once per frame rather than per tick, part of the way between
+//              their positions on the last two ticks, so they fall smoothly at any frame rate.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <random>
+#include <vector>
+#include "Core/Tetromino.hpp"
+#include "VertexLayer.hpp"
+
+class FallingTetrominoes : public sf::Drawable
+{
+public:
+	FallingTetrominoes(sf::Vector2f areaSize, size_t count = 300u);
+
+	void update(float fixedTimeStep);
+	// Write the pieces `alpha` (0 to 1) of the way from their positions on the tick before the last
+	// to the ones on the last
+	void interpolate(float alpha);
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+	static constexpr float MIN_CELL_SIZE = 8.f;
+	static constexpr float MAX_CELL_SIZE = 30.f;
+	static constexpr float MIN_SPEED = 30.f; // pixels per second, for the smallest (farthest) pieces
+	static constexpr float MAX_SPEED = 140.f;
+	static constexpr size_t VERTICES_PER_TETROMINO = 4u * VertexLayer::VERTICES_PER_QUAD;
+
+	// Give a piece a new type, size, speed and column; pieces that are respawned start above the area
+	void spawn(size_t index, bool isRespawn);
+	void writeTetromino(size_t index, float offsetY);
+
+	sf::Vector2f areaSize;
+	float lastTimeStep; // Length of the last tick, over which the pieces moved by their speed
+
+	// One entry per piece in each array
+	std::vector<float> positionsX;
+	std::vector<float> positionsY;
+	std::vector<float> speeds;
+	std::vector<float> cellSizes;
+	std::vector<Tetromino::Type> types;
+	std::vector<std::uint8_t> rotations;
+
+	VertexLayer vertices;
+	std::mt19937 rng;
+};
\ No newline at end of file
@@ -0,0 +1,210 @@
+// ================================================================================================
+// File: FrameProfiler.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include "FrameProfiler.hpp"
+#include "RenderStats.hpp"
+
+namespace
+{
+	constexpr std::array<sf::Color, FrameProfiler::PHASE_COUNT> PHASE_COLORS =
+	{{
+		sf::Color(120, 200, 255), // Input
+		sf::Color(120, 255, 150), // Update
+		sf::Color(255, 200, 90),  // Render
+		sf::Color(150, 150, 170)  // Display, mostly waiting for the vertical sync
+	}};
+	constexpr sf::Color BACKGROUND_COLOR(17, 17, 18, 220);
+	constexpr sf::Color BUDGET_LINE_COLOR(255, 80, 80, 200);
+	constexpr unsigned TEXT_LINES = FrameProfiler::PHASE_COUNT + 3u;
+
+	float toMilliseconds(std::uint32_t microseconds)
+	{
+		return microseconds / 1000.f;
+	}
+
+	// p50, p99 and the maximum of the values, which are sorted in the process
+	template <size_t N>
+	std::array<std::uint32_t, 3> getPercentiles(std::array<std::uint32_t, N>& values, size_t count)
+	{
+		if (count == 0u)
+			return { 0u, 0u, 0u };
+
+		std::sort(values.begin(), values.begin() + count);
+		return { values[(count - 1u) * 50u / 100u], values[(count - 1u) * 99u / 100u], values[count - 1u] };
+	}
+}
+
+FrameProfiler::ScopedTimer::ScopedTimer(FrameProfiler& profiler, Phase phase) :
+	profiler(profiler),
+	phase(phase),
+	start(std::chrono::steady_clock::now())
+{
+}
+
+FrameProfiler::ScopedTimer::~ScopedTimer()
+{
+	profiler.add(phase, std::chrono::steady_clock::now() - start);
+}
+
+FrameProfiler::FrameProfiler(const sf::Font& font, sf::Vector2f position) :
+	currentFrame{},
+	hitchCount(0u),
+	totalDroppedTime(0u),
+	isOverlayShown(false),
+	graph(sf::VertexBuffer::Usage::Stream),
+	text(font, "", CHARACTER_SIZE),
+	framesSinceTextUpdate(TEXT_UPDATE_INTERVAL)
+{
+	// The font may still be loading, so the layout that depends on it waits for the overlay
+	graph.resize((2u + GRAPH_FRAMES * PHASE_COUNT) * VertexLayer::VERTICES_PER_QUAD);
+	text.setPosition(position + sf::Vector2f(PADDING, PADDING));
+	text.setFillColor(sf::Color(255, 245, 210));
+}
+
+void FrameProfiler::beginFrame()
+{
+	currentFrame = {};
+	frameStart = std::chrono::steady_clock::now();
+}
+
+void FrameProfiler::addTime(Phase phase, std::chrono::steady_clock::duration duration, unsigned updateSteps)
+{
+	currentFrame.phaseTimes[phase] += static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+	currentFrame.updateSteps += updateSteps;
+}
+
+void FrameProfiler::addDroppedTime(std::chrono::steady_clock::duration duration)
+{
+	const auto microseconds = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+	currentFrame.droppedTime += microseconds;
+	totalDroppedTime += microseconds;
+}
+
+bool FrameProfiler::endFrame()
+{
+	const auto frameTime = std::chrono::steady_clock::now() - frameStart;
+	currentFrame.frameTime = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(frameTime).count());
+	currentFrame.drawCalls = RenderStats::lastFrameDrawCalls.load(std::memory_order_relaxed);
+	samples.push(currentFrame);
+
+	const bool isHitch = frameTime > HITCH_THRESHOLD;
+	if (isHitch)
+		++hitchCount;
+	return isHitch;
+}
+
+void FrameProfiler::logLastFrame(std::string_view state) const
+{
+	const Sample& sample = samples.getLatest();
+	char line[256];
+	std::snprintf(line, sizeof(line), "Frame %llu took %.2f ms (input %.2f ms, update %.2f ms in %u steps, render %.2f ms, display %.2f ms, %.2f ms of simulation dropped)",
+		static_cast<unsigned long long>(samples.getPushCount()),
+		toMilliseconds(sample.frameTime),
+		toMilliseconds(sample.phaseTimes[INPUT]),
+		toMilliseconds(sample.phaseTimes[UPDATE]),
+		sample.updateSteps,
+		toMilliseconds(sample.phaseTimes[RENDER]),
+		toMilliseconds(sample.phaseTimes[DISPLAY]),
+		toMilliseconds(sample.droppedTime));
+	std::cout << line << " while " << state << std::endl;
+}
+
+void FrameProfiler::updateOverlay()
+{
+	const size_t sampleCount = std::min(samples.getSize(), GRAPH_FRAMES);
+	const float textHeight = TEXT_LINES * text.getFont().getLineSpacing(CHARACTER_SIZE);
+	const sf::Vector2f graphPosition = text.getPosition() + sf::Vector2f(0.f, textHeight + PADDING);
+	const float barWidth = GRAPH_SIZE.x / GRAPH_FRAMES;
+
+	graph.writeQuad(0u, text.getPosition() - sf::Vector2f(PADDING, PADDING), { GRAPH_SIZE.x + 2.f * PADDING, GRAPH_SIZE.y + 3.f * PADDING + textHeight }, BACKGROUND_COLOR);
+	graph.writeQuad(VertexLayer::VERTICES_PER_QUAD, graphPosition + sf::Vector2f(0.f, GRAPH_SIZE.y * (1.f - FRAME_BUDGET / GRAPH_RANGE)), { GRAPH_SIZE.x, 1.f }, BUDGET_LINE_COLOR);
+
+	// The latest frame is on the right, frames that haven't happened yet are left empty
+	for (size_t i = 0; i < GRAPH_FRAMES; ++i)
+	{
+		const size_t age = GRAPH_FRAMES - 1u - i;
+		float barTop = graphPosition.y + GRAPH_SIZE.y;
+		for (unsigned phase = 0; phase < PHASE_COUNT; ++phase)
+		{
+			const float time = age < sampleCount ? static_cast<float>(samples.getLatest(age).phaseTimes[phase]) : 0.f;
+			const float height = std::min(time / GRAPH_RANGE * GRAPH_SIZE.y, barTop - graphPosition.y);
+			barTop -= height;
+
+			const size_t first = (2u + i * PHASE_COUNT + phase) * VertexLayer::VERTICES_PER_QUAD;
+			graph.writeQuad(first, { graphPosition.x + i * barWidth, barTop }, { barWidth, height }, PHASE_COLORS[phase]);
+		}
+	}
+	graph.upload();
+
+	if (++framesSinceTextUpdate >= TEXT_UPDATE_INTERVAL)
+	{
+		updateText();
+		framesSinceTextUpdate = 0u;
+	}
+}
+
+void FrameProfiler::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	if (!isOverlayShown)
+		return;
+
+	// The graph is a VertexLayer, which counts its own draw call, so only the one of the text is
+	// counted here
+	target.draw(graph, states);
+	target.draw(text, states);
+	RenderStats::countDrawCall();
+}
+
+void FrameProfiler::add(Phase phase, std::chrono::steady_clock::duration duration)
+{
+	currentFrame.phaseTimes[phase] += static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+void FrameProfiler::updateText()
+{
+	const size_t sampleCount = std::min(samples.getSize(), GRAPH_FRAMES);
+	std::array<std::uint32_t, GRAPH_FRAMES> values;
+	std::string string;
+	char line[128];
+
+	for (size_t i = 0; i < sampleCount; ++i)
+		values[i] = samples.getLatest(i).frameTime;
+	std::array<std::uint32_t, 3> percentiles = getPercentiles(values, sampleCount);
+	std::snprintf(line, sizeof(line), "Frame      p50 %6.2f   p99 %6.2f   max %6.2f ms\n",
+		toMilliseconds(percentiles[0]), toMilliseconds(percentiles[1]), toMilliseconds(percentiles[2]));
+	string += line;
+
+	for (unsigned phase = 0; phase < PHASE_COUNT; ++phase)
+	{
+		for (size_t i = 0; i < sampleCount; ++i)
+			values[i] = samples.getLatest(i).phaseTimes[phase];
+		percentiles = getPercentiles(values, sampleCount);
+		std::snprintf(line, sizeof(line), "%-10s p50 %6.2f   p99 %6.2f   max %6.2f ms\n",
+			PHASE_NAMES[phase].data(), toMilliseconds(percentiles[0]), toMilliseconds(percentiles[1]), toMilliseconds(percentiles[2]));
+		string += line;
+	}
+
+	for (size_t i = 0; i < sampleCount; ++i)
+		values[i] = samples.getLatest(i).updateSteps;
+	percentiles = getPercentiles(values, sampleCount);
+	std::snprintf(line, sizeof(line), "Update steps per frame p50 %u   max %u   hitches %u   dropped %.1f ms",
+		percentiles[0], percentiles[2], hitchCount, totalDroppedTime / 1000.0);
+	string += line;
+
+	for (size_t i = 0; i < sampleCount; ++i)
+		values[i] = samples.getLatest(i).drawCalls;
+	percentiles = getPercentiles(values, sampleCount);
+	std::snprintf(line, sizeof(line), "\nDraw calls per frame p50 %u   max %u", percentiles[0], percentiles[2]);
+	string += line;
+
+	text.setString(string);
+}
\ No newline at end of file
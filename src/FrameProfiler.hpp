@@ -0,0 +1,105 @@
+// ================================================================================================
+// File: FrameProfiler.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the FrameProfiler class, which measures where the time of every frame goes.
+//              Scoped timers add up the time spent in each phase of the game loop (input, update
+//              steps, render and display), and every finished frame is stored as a sample in a
+//              ring buffer, which the render thread alone uses. Frames over the hitch threshold
+//              are logged with their phase breakdown. The overlay shows a graph of the recent
+//              frame times, split into phases, together with the p50, p99 and maximum of every
+//              phase and the number of update steps the loop had to catch up on, along with the
+//              simulation time it dropped when it fell too far behind to catch up, and the number
+//              of draw calls per frame. Phases run on another thread, like the input and update
+//              steps of the simulation thread, are added to the frames they overlap with.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string_view>
+#include "RingBuffer.hpp"
+#include "VertexLayer.hpp"
+
+class FrameProfiler : public sf::Drawable
+{
+public:
+	enum Phase { INPUT, UPDATE, RENDER, DISPLAY, PHASE_COUNT };
+
+	// Frames that take longer than this are logged; 1.5 frames at 60 Hz
+	static constexpr std::chrono::microseconds HITCH_THRESHOLD{ 25000 };
+
+	// Times of a single frame in microseconds
+	struct Sample
+	{
+		std::array<std::uint32_t, PHASE_COUNT> phaseTimes;
+		std::uint32_t frameTime; // Whole frame, including anything between the phases
+		std::uint32_t updateSteps; // Fixed time steps simulated during the frame
+		std::uint32_t droppedTime; // Time the loop gave up on simulating during the frame
+		std::uint32_t drawCalls; // Issued to the window during the frame, as counted by RenderStats
+	};
+
+	// Adds the time until it goes out of scope to a phase of the current frame
+	class ScopedTimer
+	{
+	public:
+		ScopedTimer(FrameProfiler& profiler, Phase phase);
+		~ScopedTimer();
+		ScopedTimer(const ScopedTimer&) = delete;
+		ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+	private:
+		FrameProfiler& profiler;
+		Phase phase;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	FrameProfiler(const sf::Font& font, sf::Vector2f position);
+
+	void beginFrame();
+	ScopedTimer measure(Phase phase) { return ScopedTimer(*this, phase); }
+	// Add time spent on a phase by another thread since the last frame, with the update steps it took
+	void addTime(Phase phase, std::chrono::steady_clock::duration duration, unsigned updateSteps = 0u);
+	// Count simulation time the loop dropped instead of catching up on it
+	void addDroppedTime(std::chrono::steady_clock::duration duration);
+	// Store the current frame, returning true if it was a hitch
+	bool endFrame();
+	// Log the breakdown of the last frame, along with a description of what the game was doing
+	void logLastFrame(std::string_view state) const;
+
+	void toggleOverlay() { isOverlayShown = !isOverlayShown; }
+	bool isOverlayVisible() const { return isOverlayShown; }
+	// Rebuild the overlay from the latest samples, only needed while it's visible
+	void updateOverlay();
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+	const RingBuffer<Sample, 1024u>& getSamples() const { return samples; }
+
+private:
+	static constexpr size_t GRAPH_FRAMES = 240u;
+	static constexpr sf::Vector2f GRAPH_SIZE{ 360.f, 120.f };
+	static constexpr float GRAPH_RANGE = 50000.f; // Frame time at the top of the graph, in microseconds
+	static constexpr float FRAME_BUDGET = 1000000.f / 60.f;
+	static constexpr unsigned CHARACTER_SIZE = 14u;
+	static constexpr unsigned TEXT_UPDATE_INTERVAL = 15u; // Frames between updates of the numbers
+	static constexpr float PADDING = 8.f;
+	static constexpr std::array<std::string_view, PHASE_COUNT> PHASE_NAMES = { "Input", "Update", "Render", "Display" };
+
+	void add(Phase phase, std::chrono::steady_clock::duration duration);
+	void updateText();
+
+	Sample currentFrame;
+	std::chrono::steady_clock::time_point frameStart;
+	RingBuffer<Sample, 1024u> samples;
+	unsigned hitchCount;
+	std::uint64_t totalDroppedTime; // In microseconds
+
+	bool isOverlayShown;
+	VertexLayer graph; // Background, budget line, then one bar per phase for every graphed frame
+	sf::Text text;
+	unsigned framesSinceTextUpdate;
+};
\ No newline at end of file
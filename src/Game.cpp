@@ -10,18 +10,36 @@
 #include <iostream>
 #include <algorithm>
 #include <cmath>
+#include <random>
+#include <cstdio>
+#include <thread>
 #include "Game.hpp"
 #include "Utility.hpp"
+#include "RenderStats.hpp"
 
-Game::Game() :
+Game::Game(InputHandler::Clock::time_point startTime) :
 	gameState(GameState::TitleScreen),
 	isRunning(true),
 	backgroundColor(sf::Color(17, 17, 18)),
+	isFrameFrozen(false),
+	redrawCount(0u),
+	presentedRedrawCount(0u),
 	transparentDefaultOverlayColor(sf::Color(17, 17, 18, 150)),
 	transparentOverlayAlpha(transparentDefaultOverlayColor.a),
 	isPaused(false),
-	titleFont("assets/fonts/seguibl.ttf"),
-	textFont("assets/fonts/seguisb.ttf"),
+	assets(AssetArchive::getDefaultPath()),
+	fontLoading(std::async(std::launch::async, [this]
+		{
+			const AssetArchive::Asset font = assets.find(FONT_NAME);
+			return font.data && textFont.openFromMemory(font.data, font.size);
+		})),
+	isFontLoaded(false),
+	areSoundsLoaded(false),
+	areGameTextsLaidOut(false),
+	shownGameOverScore(0u),
+	startTime(startTime),
+	isStartupTimeShown(false),
+	isTitleScreenComplete(false),
 	pauseTitle(textFont, "PAUSED", 80),
 	pauseText(textFont, "Press ESC to continue", 40),
 	titleScreenTitle(textFont, "TETRIS", 160),
@@ -31,73 +49,49 @@ Game::Game() :
 	gameOverTitle(textFont, "GAME OVER", 80),
 	gameOverScore(textFont, "SCORE: 0", 50),
 	gameOverText(textFont, "    Press ESC to exit\nor ENTER to continue", 40),
-	hud(textFont),
+	profiler(textFont, { 8.f, 8.f }),
+	tickCount(0u),
+	publishCount(0u),
+	isSnapshotOutdated(false),
+	isProfilerShown(false),
+	ticksPerSecond(Simulation::TICKS_PER_SECOND),
+	isVerticalSyncEnabled(true),
 	titleColorTransitionTime(2.f),
-	score(0),
-	level(0),
-	totalLinesCleared(0),
-	currentTetromino(generator.getNext()),
-	nextTetromino(generator.getNext()),
-	tetrominoMovementDelay(BASE_MOVEMENT_DELAY),
-	tetrominoMovementTimer(0.f),
-	isTetrominoWaitingForRotation(false),
-	hasTetrominoCollidedDownward(false),
-	areLinesFlashing(false),
-	lineFlashDuration(0.4f),
-	lineFlashInterval(0.1f),
-	lineFlashTimer(0.f),
-	lineFlashPhaseTimer(0.f),
-	lineFlashPhaseSwitch(false),
-	hasInitialDelayPassed(false),
-	initialInputDelay(0.15f),
-	heldInputDelay(0.05f),
-	inputTimer(0.f),
-	heldKey(HeldKey::None),
-	heldKeyLastFrame(HeldKey::None),
-	wasKeyJustPressed(false),
-	canMoveAgain(true),
-	music("assets/music/arcade-beat-323176.mp3"),
+	animatedTick(0u),
+	titleScreenTetrominoes({ static_cast<float>(WINDOW_WIDTH), static_cast<float>(WINDOW_HEIGHT) }),
+	isAutoplayEnabled(false),
+	isReplaying(false),
+	isPracticeMode(false),
+	rewoundTicks(0u),
+	soundManager(assets),
+	isMusicChecked(false),
+	isMusicOpen(false),
 	baseMusicVolume(30.f),
 	musicVolume(0.f)
 {
+	// The font and the sounds are loaded by worker threads while the window is created
 	initializeWindow();
-	music.setLooping(true);
-
-	currentTetromino.updateDrawPosition();
-	positionNextTetromino();
-
-	hud.updateScore(score);
-	hud.updateLevel(level);
-	hud.updateLinesCleared(totalLinesCleared);
-
-	nextTetrominoBox.setSize(sf::Vector2f(5 * Cell::SIZE, 4 * Cell::SIZE));
-	nextTetrominoBox.setPosition(sf::Vector2f(WINDOW_WIDTH - 6 * Cell::SIZE, 2 * Cell::SIZE));
-	nextTetrominoBox.setFillColor(Cell::EMPTY_COLOR);
-	nextTetrominoBox.setOutlineThickness(2.5f);
-	nextTetrominoBox.setOutlineColor(Grid::OUTLINE_COLOR);
-
-	topBar.setSize(sf::Vector2f(WINDOW_WIDTH, Grid::OFFSET.y - 4));
-	topBar.setPosition(sf::Vector2f(0.f, 0.f));
-	topBar.setFillColor(backgroundColor);
+	markStartup("window created");
 
-	topBarBottomLine.setSize(sf::Vector2f(Grid::WIDTH * Cell::SIZE, 2.5f));
-	topBarBottomLine.setPosition(sf::Vector2f(Grid::OFFSET.x, Grid::OFFSET.y - 3.5f));
-	topBarBottomLine.setFillColor(Grid::OUTLINE_COLOR);
+	boardRenderer.setLayout({ WINDOW_WIDTH, WINDOW_HEIGHT }, backgroundColor);
+	boardState.capture(simulation);
+	updateTime = InputHandler::Clock::now();
 
 	transparentOverlay.setSize(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
 	transparentOverlay.setPosition(sf::Vector2f(0.f, 0.f));
 	transparentOverlay.setFillColor(transparentDefaultOverlayColor);
 
-	pauseTitle.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - pauseTitle.getGlobalBounds().size.x / 2.f, WINDOW_HEIGHT / 2.f - pauseTitle.getGlobalBounds().size.y));
-	pauseTitle.setFillColor(sf::Color(255, 245, 210));
-	pauseTitle.setOutlineColor(sf::Color::White);
-	pauseTitle.setOutlineThickness(0.5f);
-
-	pauseText.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - pauseText.getGlobalBounds().size.x / 2.f, WINDOW_HEIGHT / 2.f + pauseTitle.getGlobalBounds().size.y));
-	pauseText.setFillColor(sf::Color(255, 245, 210));
-	pauseText.setOutlineColor(sf::Color::White);
-	pauseText.setOutlineThickness(0.5f);
+	// Shown before the font and the sounds are loaded, the text of the title screen follows. The
+	// render thread isn't started yet, so this thread can draw the first frame itself.
+	publishSnapshot(false);
+	snapshots.update();
+	updateScene(snapshots.getReadBuffer());
+	render(snapshots.getReadBuffer());
+	markStartup("first frame presented");
+}
 
+void Game::layoutTitleScreen()
+{
 	titleScreenTitle.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - titleScreenTitle.getGlobalBounds().size.x / 2.f, WINDOW_HEIGHT / 2.f - titleScreenTitle.getGlobalBounds().size.y * 1.5f));
 	titleScreenTitle.setFillColor(sf::Color(255, 245, 210));
 	titleScreenTitle.setOutlineColor(sf::Color::White);
@@ -116,6 +110,22 @@ Game::Game() :
 
 	titleScreenAuthorShadow.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - titleScreenAuthor.getGlobalBounds().size.x / 2.f + 2, WINDOW_HEIGHT - titleScreenTitle.getGlobalBounds().size.y * 0.55f + 2));
 	titleScreenAuthorShadow.setFillColor(sf::Color(0, 0, 0, 200));
+}
+
+void Game::layoutGameTexts()
+{
+	if (areGameTextsLaidOut)
+		return;
+
+	pauseTitle.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - pauseTitle.getGlobalBounds().size.x / 2.f, WINDOW_HEIGHT / 2.f - pauseTitle.getGlobalBounds().size.y));
+	pauseTitle.setFillColor(sf::Color(255, 245, 210));
+	pauseTitle.setOutlineColor(sf::Color::White);
+	pauseTitle.setOutlineThickness(0.5f);
+
+	pauseText.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - pauseText.getGlobalBounds().size.x / 2.f, WINDOW_HEIGHT / 2.f + pauseTitle.getGlobalBounds().size.y));
+	pauseText.setFillColor(sf::Color(255, 245, 210));
+	pauseText.setOutlineColor(sf::Color::White);
+	pauseText.setOutlineThickness(0.5f);
 
 	gameOverTitle.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - gameOverTitle.getGlobalBounds().size.x / 2.f, WINDOW_HEIGHT / 2.f - gameOverTitle.getGlobalBounds().size.y * 2.f));
 	gameOverTitle.setFillColor(sf::Color(255, 245, 210));
@@ -131,239 +141,548 @@ Game::Game() :
 	gameOverText.setFillColor(sf::Color(255, 245, 210));
 	gameOverText.setOutlineColor(sf::Color::White);
 	gameOverText.setOutlineThickness(0.5f);
+	areGameTextsLaidOut = true;
+}
+
+void Game::setRepeatTiming(std::chrono::milliseconds das, std::chrono::milliseconds arr)
+{
+	inputHandler.setRepeatTiming(das, arr);
+}
+
+bool Game::loadReplay(const std::string& path)
+{
+	if (!replay.loadFromFile(path))
+		return false;
+
+	isReplaying = true;
+	titleScreenText.setString("Press ENTER to watch the replay");
+	if (isFontLoaded)
+		titleScreenText.setOrigin(sf::Vector2f(titleScreenText.getGlobalBounds().size.x / 2.f, titleScreenText.getGlobalBounds().size.y / 2.f));
+	return true;
+}
+
+void Game::setVerticalSyncEnabled(bool isEnabled)
+{
+	isVerticalSyncEnabled = isEnabled;
+	window.setVerticalSyncEnabled(isEnabled);
+}
+
+void Game::setTickRate(unsigned ticksPerSecond)
+{
+	this->ticksPerSecond = std::max(ticksPerSecond, 1u);
+}
+
+void Game::startLatencyTest(unsigned sampleCount)
+{
+	gameState = GameState::InGame;
+	isAutoplayEnabled = false;
+	isReplaying = false;
+	resetGame();
+	latencyProbe.start(sampleCount);
 }
 
 int Game::run()
 {
-	const float FIXED_TIME_STEP = 1.f / 60.f; // Fixed time step per update
-	sf::Clock clock;						  // Clock to measure time
-	float timeSinceLastUpdate = 0.f;		  // Time accumulator for fixed timestep
-	float interpolationFactor = 0.f;		  // Interpolation factor for rendering
+	using Clock = InputHandler::Clock;
+
+	// Elapsed time is accumulated in integer nanoseconds multiplied by the tick rate, in which a step
+	// is exactly one second, so no rounding error builds up over a long session
+	const std::int64_t STEP = std::chrono::nanoseconds(std::chrono::seconds(1)).count();
+	std::int64_t accumulator = 0;
+	Clock::time_point lastTime = Clock::now();
+	const auto toDuration = [this](std::int64_t time) { return std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(time / ticksPerSecond)); };
+
+	// The events of the window can only be polled on the thread that created it, so the simulation
+	// stays on this one and the OpenGL context of the window moves to the render thread
+	(void)window.setActive(false);
+	std::thread renderThread(&Game::renderLoop, this);
 
 	while (isRunning)
 	{
-		timeSinceLastUpdate += clock.restart().asSeconds();
+		updateLoading();
+		const Clock::time_point pollTime = Clock::now();
+		accumulator += std::chrono::duration_cast<std::chrono::nanoseconds>(pollTime - lastTime).count() * ticksPerSecond;
+		lastTime = pollTime;
 		processInput();
+		simulationTimes.input += Clock::now() - pollTime;
 
-		while (timeSinceLastUpdate >= FIXED_TIME_STEP)
+		// After a stall, only a few steps are caught up on and the rest of the time is dropped, as
+		// every step taken to catch up would make the next one later still
+		if (accumulator > MAX_CATCH_UP_STEPS * STEP)
 		{
-			update(FIXED_TIME_STEP);
-			timeSinceLastUpdate -= FIXED_TIME_STEP;
+			const std::int64_t dropped = accumulator - MAX_CATCH_UP_STEPS * STEP;
+			accumulator -= dropped;
+			simulationTimes.dropped += toDuration(dropped);
 		}
 
-		interpolationFactor = timeSinceLastUpdate / FIXED_TIME_STEP;
-		render();
+		// Every step is simulated as of the time it ends at, so input is handed to the step that
+		// covers the time it happened at
+		const Clock::time_point now = Clock::now();
+		while (accumulator >= STEP)
+		{
+			updateTime = now - toDuration(accumulator - STEP);
+			update();
+			accumulator -= STEP;
+			++simulationTimes.steps;
+			isSnapshotOutdated = true;
+		}
+		simulationTimes.update += Clock::now() - now;
+
+		if (isRunning && isIdle())
+		{
+			// Nothing on screen changes until an event arrives, so the render thread presents the
+			// last frame frozen while this one sleeps until then
+			publishSnapshot(true);
+			if (const std::optional event = window.waitEvent())
+				handleEvent(*event);
+
+			// Time spent waiting is not simulated
+			lastTime = Clock::now();
+			accumulator = 0;
+			inputHandler.restartRepeat(lastTime);
+			continue;
+		}
+
+		if (isSnapshotOutdated)
+			publishSnapshot(false);
+
+		// Sleep until the next step is due, but wake up often enough to take the events close to
+		// the time they arrive at, which is the time they are stamped with
+		const Clock::duration untilNextStep = toDuration(STEP - accumulator) - (Clock::now() - now);
+		const auto sleepTime = std::chrono::duration_cast<std::chrono::microseconds>(std::min<Clock::duration>(untilNextStep, INPUT_POLL_INTERVAL));
+		if (sleepTime.count() > 0)
+			sf::sleep(sf::microseconds(sleepTime.count()));
 	}
+
+	// The render thread may be waiting for a snapshot that will never come
+	wakeRenderThread();
+	renderThread.join();
 	return 0;
 }
 
+void Game::publishSnapshot(bool isIdle)
+{
+	Snapshot& snapshot = snapshots.getWriteBuffer();
+	snapshot.gameState = gameState;
+	snapshot.isPaused = isPaused;
+	snapshot.isGameOver = simulation.isGameOver();
+	snapshot.isIdle = isIdle;
+	snapshot.isProfilerShown = isProfilerShown;
+	snapshot.isReplaying = isReplaying;
+	snapshot.isAutoplayEnabled = isAutoplayEnabled;
+	snapshot.overlayAlpha = static_cast<std::uint8_t>(transparentOverlayAlpha);
+	snapshot.redrawCount = redrawCount;
+	snapshot.board = boardState;
+	snapshot.score = simulation.getScore();
+	snapshot.level = simulation.getLevel();
+	snapshot.linesCleared = simulation.getTotalLinesCleared();
+	snapshot.tick = tickCount;
+	snapshot.tickTime = updateTime;
+	snapshot.simulationTimes = simulationTimes;
+	snapshots.publish();
+	isSnapshotOutdated = false;
+	wakeRenderThread();
+}
+
+void Game::wakeRenderThread()
+{
+	{
+		// Counted under the lock so the render thread can't miss it between checking and waiting
+		const std::lock_guard<std::mutex> lock(publishMutex);
+		publishCount.fetch_add(1u, std::memory_order_release);
+	}
+	snapshotPublished.notify_one();
+}
+
+void Game::renderLoop()
+{
+	(void)window.setActive(true);
+
+	while (isRunning)
+	{
+		// Taken before the snapshot, so one published in between is never waited for
+		const std::uint64_t seenPublishCount = publishCount.load(std::memory_order_acquire);
+		const bool isSnapshotNew = snapshots.update();
+		const Snapshot& snapshot = snapshots.getReadBuffer();
+		updateFontLoading();
+
+		// The steps the simulation thread took since the last frame are added to it
+		profiler.beginFrame();
+		const SimulationTimes& times = snapshot.simulationTimes;
+		profiler.addTime(FrameProfiler::INPUT, times.input - profiledTimes.input);
+		profiler.addTime(FrameProfiler::UPDATE, times.update - profiledTimes.update, static_cast<unsigned>(times.steps - profiledTimes.steps));
+		profiler.addDroppedTime(times.dropped - profiledTimes.dropped);
+		profiledTimes = times;
+
+		{
+			const auto timer = profiler.measure(FrameProfiler::RENDER);
+			if (isSnapshotNew)
+				updateScene(snapshot);
+			interpolate(snapshot);
+		}
+
+		if (snapshot.isIdle)
+		{
+			// Present a frozen copy of the frame once, and again only when the window needs it,
+			// instead of redrawing the same frame every vsync
+			if (!isFrameFrozen)
+			{
+				freezeFrame(snapshot);
+				presentedRedrawCount = snapshot.redrawCount + 1u;
+			}
+			if (presentedRedrawCount != snapshot.redrawCount)
+			{
+				render(snapshot);
+				presentedRedrawCount = snapshot.redrawCount;
+			}
+			else
+			{
+				// Neither is an idle frame profiled. Nothing changes until the next snapshot, so the
+				// thread sleeps until it's published and draws it at once
+				std::unique_lock<std::mutex> lock(publishMutex);
+				snapshotPublished.wait(lock, [this, seenPublishCount] { return publishCount.load(std::memory_order_relaxed) != seenPublishCount || !isRunning; });
+			}
+			continue;
+		}
+
+		isFrameFrozen = false;
+		render(snapshot);
+
+		if (profiler.endFrame())
+			profiler.logLastFrame(describeState(snapshot));
+	}
+	(void)window.setActive(false);
+}
+
+void Game::updateScene(const Snapshot& snapshot)
+{
+	if (snapshot.isProfilerShown != profiler.isOverlayVisible())
+		profiler.toggleOverlay();
+
+	if (snapshot.gameState == GameState::TitleScreen)
+	{
+		// The title screen animates by the steps taken since the last snapshot
+		const float fixedTimeStep = 1.f / static_cast<float>(ticksPerSecond);
+		const std::uint64_t steps = std::min<std::uint64_t>(snapshot.tick - animatedTick, MAX_CATCH_UP_STEPS);
+		for (std::uint64_t i = 0; i < steps; ++i)
+		{
+			updateTitleColor(fixedTimeStep);
+			pulseTitleText(fixedTimeStep);
+			titleScreenTetrominoes.update(fixedTimeStep);
+		}
+		animatedTick = snapshot.tick;
+		return;
+	}
+	animatedTick = snapshot.tick;
+
+	// The first game needs the font for the HUD and the texts drawn over the board
+	if (!hud)
+	{
+		waitForFont();
+		if (!isFontLoaded)
+			return;
+		hud.emplace(textFont);
+		layoutGameTexts();
+	}
+	boardRenderer.update(snapshot.board);
+	hud->updateScore(static_cast<int>(snapshot.score));
+	hud->updateLevel(static_cast<int>(snapshot.level));
+	hud->updateLinesCleared(static_cast<int>(snapshot.linesCleared));
+
+	transparentOverlay.setFillColor(sf::Color
+	(
+		transparentDefaultOverlayColor.r,
+		transparentDefaultOverlayColor.g,
+		transparentDefaultOverlayColor.b,
+		snapshot.overlayAlpha
+	));
+
+	if (snapshot.isGameOver && shownGameOverScore != snapshot.score)
+	{
+		shownGameOverScore = snapshot.score;
+		gameOverScore.setString("SCORE: " + std::to_string(snapshot.score));
+		gameOverScore.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - gameOverScore.getGlobalBounds().size.x / 2.f, WINDOW_HEIGHT / 2.f));
+	}
+}
+
+void Game::interpolate(const Snapshot& snapshot)
+{
+	// Moving things are drawn between the last two steps, by how far the time is into the next
+	const float interpolation = std::clamp(std::chrono::duration<float>(InputHandler::Clock::now() - snapshot.tickTime).count() * static_cast<float>(ticksPerSecond), 0.f, 1.f);
+	boardRenderer.interpolate(snapshot.gameState == GameState::InGame && !snapshot.isPaused ? interpolation : 1.f);
+	if (snapshot.gameState == GameState::TitleScreen)
+		titleScreenTetrominoes.interpolate(interpolation);
+}
+
+void Game::handleEvent(const sf::Event& event)
+{
+	// Events carry no time of their own, so they are stamped as they are taken from the queue
+	inputHandler.handleEvent(event, InputHandler::Clock::now());
+
+	isSnapshotOutdated = true;
+
+	if (event.is<sf::Event::Closed>())
+	{
+		isRunning = false;
+	}
+	else if (event.is<sf::Event::FocusLost>())
+	{
+		// Keys released while another window has the focus are never reported
+		inputHandler.releaseAll();
+
+		// Minimizing the window also takes its focus, so a game left in the background pauses
+		if (gameState == GameState::InGame && !isPaused)
+		{
+			isPaused = true;
+			soundManager.playSound(SoundManager::SoundID::PAUSE, 0.f, 1.f, 0.15f);
+		}
+	}
+	else if (event.is<sf::Event::FocusGained>() || event.is<sf::Event::Resized>())
+	{
+		++redrawCount;
+	}
+}
+
+bool Game::isIdle() const
+{
+	// The loop has to keep polling the workers
+	if (!isFontLoaded || !areSoundsLoaded)
+		return false;
+
+	// The profiler overlay keeps measuring frames
+	if (isProfilerShown)
+		return false;
+
+	switch (gameState)
+	{
+	case GameState::TitleScreen:
+		// The title screen animates, but only while someone can see it
+		return !window.hasFocus();
+
+	case GameState::InGame:
+		return isPaused;
+
+	case GameState::GameOver:
+		// Idle once the overlay and the music have faded out
+		return transparentOverlayAlpha >= 200 && (!isMusicOpen || musicVolume <= 0.f);
+	}
+	return false;
+}
+
+void Game::freezeFrame(const Snapshot& snapshot)
+{
+	sf::ContextSettings settings;
+	settings.antiAliasingLevel = 8;
+	if (frozenFrame.getSize() != window.getSize() && !frozenFrame.resize(window.getSize(), settings))
+	{
+		std::cerr << "Error: Failed to create the frozen frame texture." << std::endl;
+		return;
+	}
+
+	renderScene(frozenFrame, snapshot);
+	frozenFrame.display();
+	isFrameFrozen = true;
+}
+
 void Game::processInput()
 {
 	// Handle window events regardless of current game state
 	while (const std::optional event = window.pollEvent())
-		if (event->is<sf::Event::Closed>())
+		handleEvent(*event);
+
+	// Synthetic presses of the latency test take the same path as the events of the window
+	if (latencyProbe.isRunning() && gameState == GameState::InGame && !isPaused)
+	{
+		if (const std::optional event = latencyProbe.takeEvent(InputHandler::Clock::now(), simulation.getCurrentTetromino().position.x))
+			handleEvent(*event);
+
+		if (latencyProbe.isFinished())
+		{
+			const std::string settings = std::string("vsync ") + (isVerticalSyncEnabled ? "on" : "off") + ", " + std::to_string(ticksPerSecond) + " ticks per second";
+			latencyProbe.report(std::cout, settings);
 			isRunning = false;
+		}
+	}
+
+	if (inputHandler.consumePress(InputHandler::PROFILER) && isFontLoaded)
+	{
+		isProfilerShown = !isProfilerShown;
+		++redrawCount;
+	}
 
 	switch (gameState)
 	{
 	case GameState::TitleScreen:
-		if (Utility::isKeyReleased(sf::Keyboard::Key::Enter))
+	{
+		// F1 starts a game played by the bot, e.g. as an attract mode
+		const bool isStartPressed = inputHandler.consumePress(InputHandler::CONFIRM) || inputHandler.consumePress(InputHandler::PAUSE);
+		const bool isAutoplayPressed = inputHandler.consumePress(InputHandler::AUTOPLAY);
+		if (isStartPressed || isAutoplayPressed)
 		{
 			soundManager.playSound(SoundManager::SoundID::GAME_START, 0.f, 1.f, 1.5f);
 			gameState = GameState::InGame;
 			resetGame();
+			isAutoplayEnabled = isAutoplayPressed && !isReplaying;
 
-			music.setVolume(0.f);
-			music.play();
+			playMusic();
 		}
-		else if (Utility::isKeyReleased(sf::Keyboard::Key::Escape))
+		else if (inputHandler.consumePress(InputHandler::BACK))
 		{
 			isRunning = false;
 		}
 		break;
+	}
 
 	case GameState::InGame:
 		// Pause and resume
-		if (Utility::isKeyReleased(sf::Keyboard::Key::Escape) ||
-			Utility::isKeyReleased(sf::Keyboard::Key::P))
+		if (inputHandler.consumePress(InputHandler::BACK) ||
+			inputHandler.consumePress(InputHandler::PAUSE))
 		{
 			isPaused = !isPaused;
 			soundManager.playSound(SoundManager::SoundID::PAUSE, 0.f, 1.f, 0.15f);
 		}
 
 		// Prevent other input while paused
-		if (isPaused) return;
+		if (isPaused) break;
 
-		// Rotation
-		if (Utility::isKeyReleased(sf::Keyboard::Key::Space) ||
-			Utility::isKeyReleased(sf::Keyboard::Key::R) ||
-			Utility::isKeyReleased(sf::Keyboard::Key::Up) ||
-			Utility::isKeyReleased(sf::Keyboard::Key::W))
-		{
-			isTetrominoWaitingForRotation = true;
-		}
-
-		heldKeyLastFrame = heldKey;
+		// The replay provides the input while it's played back
+		if (isReplaying) break;
 
-		// Move left
-		if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left) ||
-			sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A))
-		{
-			heldKey = HeldKey::Left;
-			if (heldKeyLastFrame != heldKey && canMoveAgain)
-			{
-				currentTetromino.tryMove({ -1, 0 }, grid);
-				currentTetromino.updateDrawPosition();
-				canMoveAgain = false;
-				inputTimer = 0.f;
-				hasInitialDelayPassed = false;
-			}
-		}
-		// Move right
-		else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right) ||
-			sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D))
-		{
-			heldKey = HeldKey::Right;
-			if (heldKeyLastFrame != heldKey && canMoveAgain)
-			{
-				currentTetromino.tryMove({ 1, 0 }, grid);
-				currentTetromino.updateDrawPosition();
-				canMoveAgain = false;
-				inputTimer = 0.f;
-				hasInitialDelayPassed = false;
-			}
-		}
-		// Move down
-		else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down) ||
-			sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S))
-		{
-			heldKey = HeldKey::Down;
-		}
-		else
+		// Autoplay on and off
+		if (inputHandler.consumePress(InputHandler::AUTOPLAY))
 		{
-			heldKey = HeldKey::None;
-			hasInitialDelayPassed = false;
+			isAutoplayEnabled = !isAutoplayEnabled;
+			input = Simulation::Input();
+			autoPlayer.reset();
 		}
+		// The bot provides the input while autoplay is on
+		if (isAutoplayEnabled) break;
+
+		// Actions fire on press and are kept until the next simulation step; sideways movement is
+		// handed to every step by the input handler
+		input.hardDrop |= inputHandler.consumePress(InputHandler::HARD_DROP);
+		input.rotateCW |= inputHandler.consumePress(InputHandler::ROTATE_CW);
+		input.rotateCCW |= inputHandler.consumePress(InputHandler::ROTATE_CCW);
+		input.rotate180 |= inputHandler.consumePress(InputHandler::ROTATE_180);
+		input.down |= inputHandler.consumePress(InputHandler::SOFT_DROP) || inputHandler.isHeld(InputHandler::SOFT_DROP);
 		break;
 
 	case GameState::GameOver:
-		if (Utility::isKeyReleased(sf::Keyboard::Key::Escape))
+		if (inputHandler.consumePress(InputHandler::BACK))
 		{
 			isRunning = false;
 		}
-		else if (Utility::isKeyReleased(sf::Keyboard::Key::Enter))
+		else if (inputHandler.consumePress(InputHandler::CONFIRM) || inputHandler.consumePress(InputHandler::PAUSE))
 		{
 			gameState = GameState::TitleScreen;
 		}
+		else if (isPracticeMode && !isReplaying && inputHandler.isHeld(InputHandler::REWIND) && rewindBuffer.stepBack(simulation))
+		{
+			// A game that topped out in practice can be rewound and played on, once it's back at a
+			// state before the game over
+			++rewoundTicks;
+			boardState.capture(simulation);
+			input = Simulation::Input();
+			autoPlayer.reset();
+			gameState = GameState::InGame;
+			transparentOverlayAlpha = transparentDefaultOverlayColor.a;
+			isSnapshotOutdated = true;
+		}
 		break;
 	}
+
+	// Presses that meant nothing in this state are dropped
+	inputHandler.clearPresses();
 }
 
-void Game::update(float fixedTimeStep)
+void Game::update()
 {
+	// Moves are taken every step, even when they aren't used, so none are left over for later
+	const int shift = inputHandler.consumeShift(updateTime);
+	++tickCount;
+
 	switch (gameState)
 	{
 	case GameState::TitleScreen:
-		music.stop();
-
-		updateTitleColor(fixedTimeStep);
-		pulseTitleText(fixedTimeStep);
+		// The title screen is animated by the render thread
+		if (isMusicOpen)
+			music.stop();
 		break;
 
 	case GameState::InGame:
 		if (isPaused) return;
 
-		canMoveAgain = true;
-
-		if (music.getVolume() < baseMusicVolume)
+		if (isMusicOpen && musicVolume < baseMusicVolume)
 		{
 			musicVolume += 0.05f;
-			if (music.getVolume() > baseMusicVolume)
+			if (musicVolume > baseMusicVolume)
 				musicVolume = baseMusicVolume;
 
 			music.setVolume(musicVolume);
 		}
 
-		updateTetrominoMovement(fixedTimeStep);
-
-		if (isTetrominoWaitingForRotation)
-		{
-			currentTetromino.tryRotateCW(grid);
-			currentTetromino.updateDrawPosition();
-			isTetrominoWaitingForRotation = false;
-		}
-		
-		if (hasTetrominoCollidedDownward)
+		// Held down, REWIND steps back instead of forward, as smoothly as the game plays
+		if (isPracticeMode && !isReplaying && inputHandler.isHeld(InputHandler::REWIND))
 		{
-			lockTetromino();
-			if (isGameOver())
+			if (rewindBuffer.stepBack(simulation))
 			{
-				gameState = GameState::GameOver;
-				gameOverScore.setString("SCORE: " + std::to_string(score));
-				gameOverScore.setPosition(sf::Vector2f(WINDOW_WIDTH / 2.f - gameOverScore.getGlobalBounds().size.x / 2.f, WINDOW_HEIGHT / 2.f));
-				soundManager.playSound(SoundManager::SoundID::GAME_OVER, 0.f, 1.f, 2.5f);
-				return;
+				++rewoundTicks;
+				boardState.capture(simulation);
 			}
-			soundManager.playSound(SoundManager::SoundID::COLLISION, 0.25f, 3.5f, 0.3f);
-
-			generateNextTetromino();
-			hasTetrominoCollidedDownward = false;
-
-			filledLines = grid.getFilledLines();
-			if (!filledLines.empty())
-				areLinesFlashing = true;
+			input = Simulation::Input();
+			autoPlayer.reset();
+			break;
 		}
 
-		if (areLinesFlashing)
+		// The ticks that were stepped back over are recorded again
+		if (rewoundTicks > 0u)
 		{
-			lineFlashTimer += fixedTimeStep;
-			lineFlashPhaseTimer += fixedTimeStep;
-
-			if (lineFlashPhaseTimer >= lineFlashInterval)
-			{
-				lineFlashPhaseTimer = 0.f;
-				lineFlashPhaseSwitch = !lineFlashPhaseSwitch;
+			replay.truncate(replay.getTickCount() - rewoundTicks);
+			rewoundTicks = 0u;
+		}
 
-				for (const auto& line : filledLines)
-					for (unsigned x = 0; x < Grid::WIDTH; ++x)
-						grid.overwriteCellDrawColor({ x, line }, lineFlashPhaseSwitch ? sf::Color::Transparent : sf::Color::White);
-			}
+		if (isReplaying)
+			input = replayPlayer.next();
+		else if (isAutoplayEnabled)
+			input = autoPlayer.update(simulation, AUTOPLAY_BUDGET);
+		else
+			input.shift = static_cast<std::int8_t>(shift);
+
+		if (!isReplaying)
+			replay.record(input);
+		simulation.step(input);
+		input.shift = 0;
+		input.rotateCW = false;
+		input.rotateCCW = false;
+		input.rotate180 = false;
+		input.hardDrop = false;
+		input.down = false;
+
+		if (isPracticeMode && !isReplaying)
+			rewindBuffer.push(simulation);
+		boardState.capture(simulation);
+		handleSimulationEvents();
+
+		if (latencyProbe.isRunning())
+		{
+			// A new tetromino would move the watched column without any input
+			const bool isLocked = simulation.hasEvent(Simulation::TETROMINO_LOCKED) || simulation.hasEvent(Simulation::GAME_OVER);
+			latencyProbe.observe(simulation.getCurrentTetromino().position.x, isLocked, InputHandler::Clock::now(), tickCount);
 
-			if (lineFlashTimer >= lineFlashDuration)
+			// The test keeps playing until it has all its samples
+			if (gameState == GameState::GameOver)
 			{
-				areLinesFlashing = false;
+				gameState = GameState::InGame;
+				resetGame();
 			}
 		}
-		if (!areLinesFlashing && !filledLines.empty())
-		{
-			int previousLevel = level;
-
-			lineFlashTimer = 0.f;
-			lineFlashPhaseTimer = 0.f;
-
-			score += getScoreWorth(filledLines.size());	
-			totalLinesCleared += filledLines.size();
-			level = totalLinesCleared / LINES_PER_LEVEL;
-			tetrominoMovementDelay = std::max(MINIMUM_MOVEMENT_DELAY, BASE_MOVEMENT_DELAY - (level * MOVEMENT_DELAY_DECREASE));
-			if (previousLevel != level)
-				soundManager.playSoundAtPitch(SoundManager::SoundID::LEVEL_UP, 1.0f + static_cast<float>((level - 1) * 0.05f));
-
-			hud.updateScore(score);
-			hud.updateLevel(level);
-			hud.updateLinesCleared(totalLinesCleared);
-
-			grid.clearFilledLinesAndPushDown(filledLines);
-			soundManager.playSoundAtPitch(SoundManager::SoundID::LINE_CLEAR, 1.0f + static_cast<float>((filledLines.size() - 1) * 0.25f), 1.f);
-
-			filledLines.clear();
-		}
 		break;
 
 	case GameState::GameOver:
-		if (music.getVolume() > 0.f)
+		if (isMusicOpen && musicVolume > 0.f)
 		{
 			musicVolume -= 0.1f;
-			if (music.getVolume() < 0.f)
+			if (musicVolume < 0.f)
 				musicVolume = 0.f;
 
 			music.setVolume(musicVolume);
@@ -374,62 +693,95 @@ void Game::update(float fixedTimeStep)
 			transparentOverlayAlpha += 1;
 			if (transparentOverlayAlpha > 200)
 				transparentOverlayAlpha = 200;
-
-			transparentOverlay.setFillColor(sf::Color
-			(
-				transparentDefaultOverlayColor.r,
-				transparentDefaultOverlayColor.g,
-				transparentDefaultOverlayColor.b,
-				transparentOverlayAlpha
-			));
 		}
 		break;
 	}
-	soundManager.cleanupSounds(fixedTimeStep, 10.f);
 }
 
-void Game::render()
+void Game::render(const Snapshot& snapshot)
 {
-	window.clear(backgroundColor);
+	{
+		const auto timer = profiler.measure(FrameProfiler::RENDER);
+		if (isFrameFrozen)
+		{
+			window.clear(backgroundColor);
+			draw(window, sf::Sprite(frozenFrame.getTexture()));
+		}
+		else
+		{
+			renderScene(window, snapshot);
+		}
 
-	switch (gameState)
+		if (profiler.isOverlayVisible())
+		{
+			profiler.updateOverlay();
+			window.draw(profiler);
+		}
+	}
+	{
+		const auto timer = profiler.measure(FrameProfiler::DISPLAY);
+		window.display();
+	}
+
+	if (isFontLoaded && !isTitleScreenComplete && snapshot.gameState == GameState::TitleScreen)
+	{
+		markStartup("title screen complete");
+		isTitleScreenComplete = true;
+	}
+
+	if (latencyProbe.isRunning())
+		latencyProbe.markPresented(InputHandler::Clock::now(), snapshot.tick);
+
+	// The profiler takes the count of the frame along with its times
+	RenderStats::endFrame();
+}
+
+void Game::renderScene(sf::RenderTarget& target, const Snapshot& snapshot)
+{
+	target.clear(backgroundColor);
+
+	switch (snapshot.gameState)
 	{
 	case GameState::TitleScreen:
-		window.draw(titleScreenShapes);
-		window.draw(titleScreenTitle);
-		window.draw(titleScreenText);
-		window.draw(titleScreenAuthorShadow);
-		window.draw(titleScreenAuthor);
+		target.draw(titleScreenTetrominoes);
+		target.draw(titleScreenShapes);
+		if (!isFontLoaded)
+			break;
+		draw(target, titleScreenTitle);
+		draw(target, titleScreenText);
+		draw(target, titleScreenAuthorShadow);
+		draw(target, titleScreenAuthor);
 		break;
 
 	case GameState::InGame:
 	case GameState::GameOver:
-		window.draw(topBar);
-		window.draw(grid);
-		window.draw(currentTetromino);
-		window.draw(nextTetrominoBox);
-		window.draw(nextTetromino);
-		window.draw(topBar);
-		window.draw(topBarBottomLine);
-		window.draw(hud);
-
-		if (isPaused)
+		target.draw(boardRenderer);
+		// Without the HUD, the font failed to load and the game is quitting
+		if (!hud)
+			break;
+		target.draw(*hud);
+
+		if (snapshot.isPaused)
 		{
-			window.draw(transparentOverlay);
-			window.draw(pauseTitle);
-			window.draw(pauseText);
+			draw(target, transparentOverlay);
+			draw(target, pauseTitle);
+			draw(target, pauseText);
 		}
-		if (isGameOver())
+		if (snapshot.isGameOver)
 		{
-			window.draw(transparentOverlay);
-			window.draw(gameOverTitle);
-			window.draw(gameOverScore);
-			window.draw(gameOverText);
+			draw(target, transparentOverlay);
+			draw(target, gameOverTitle);
+			draw(target, gameOverScore);
+			draw(target, gameOverText);
 		}
 		break;
 	}
+}
 
-	window.display();
+void Game::draw(sf::RenderTarget& target, const sf::Drawable& drawable)
+{
+	target.draw(drawable);
+	RenderStats::countDrawCall();
 }
 
 void Game::initializeWindow()
@@ -438,38 +790,114 @@ void Game::initializeWindow()
 	settings.antiAliasingLevel = 8;
 	window.create(sf::VideoMode(sf::Vector2u(WINDOW_WIDTH, WINDOW_HEIGHT)), "Tetris", sf::Style::Close, sf::State::Windowed, settings);
 	window.setVerticalSyncEnabled(true);
+	// Held keys are tracked by the input handler, which ignores the repeated key presses anyway
+	window.setKeyRepeatEnabled(false);
 }
 
 void Game::resetGame()
 {
 	isPaused = false;
-	transparentOverlay.setFillColor(transparentDefaultOverlayColor);
 	transparentOverlayAlpha = transparentDefaultOverlayColor.a;
-	score = 0;
-	level = 0;
-	totalLinesCleared = 0;
-	hud.updateScore(score);
-	hud.updateLevel(level);
-	hud.updateLinesCleared(totalLinesCleared);
-	filledLines.clear();
-	tetrominoMovementDelay = BASE_MOVEMENT_DELAY;
-	tetrominoMovementTimer = 0.f;
-	isTetrominoWaitingForRotation = false;
-	hasTetrominoCollidedDownward = false;
-	areLinesFlashing = false;
-	lineFlashTimer = 0.f;
-	lineFlashPhaseTimer = 0.f;
-	lineFlashPhaseSwitch = false;
-	heldKeyLastFrame = HeldKey::None;
-	heldKey = HeldKey::None;
-	inputTimer = 0.f;
-	wasKeyJustPressed = false;
-	grid.reset();
-	generator.reset();
-	currentTetromino = generator.getNext();
-	nextTetromino = generator.getNext();
-	currentTetromino.updateDrawPosition();
-	positionNextTetromino();
+	input = Simulation::Input();
+	autoPlayer.reset();
+
+	// Every game gets its own seed, which is all the replay needs to reproduce its tetrominoes
+	if (isReplaying)
+	{
+		simulation.reset(replay.getSeed());
+		replayPlayer = Replay::Player(replay);
+	}
+	else
+	{
+		const std::uint32_t seed = std::random_device{}();
+		simulation.reset(seed);
+		replay.start(seed);
+	}
+
+	// A game can be rewound back to its start
+	rewindBuffer.clear();
+	rewoundTicks = 0u;
+	if (isPracticeMode && !isReplaying)
+		rewindBuffer.push(simulation);
+
+	boardState.capture(simulation);
+	isSnapshotOutdated = true;
+}
+
+void Game::updateLoading()
+{
+	if (!areSoundsLoaded && soundManager.isLoaded())
+	{
+		areSoundsLoaded = true;
+		markStartup("sounds decoded");
+	}
+
+	// Startup is over once the full title screen is up and everything is loaded
+	if (isStartupTimeShown && isTitleScreenComplete && areSoundsLoaded)
+	{
+		const std::lock_guard<std::mutex> lock(startupMutex);
+		char line[96];
+		for (const auto& [step, time] : startupSteps)
+		{
+			std::snprintf(line, sizeof(line), "%.1f ms", std::chrono::duration<double, std::milli>(time - startTime).count());
+			std::cout << "Startup: " << step << " after " << line << std::endl;
+		}
+		isRunning = false;
+	}
+}
+
+void Game::updateFontLoading()
+{
+	if (fontLoading.valid() && fontLoading.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+	{
+		// Nothing can be shown without the text, so the game quits like it did when the font was
+		// loaded up front
+		if (!fontLoading.get())
+		{
+			std::cerr << "Error: Failed to load the font " << FONT_NAME << " from the asset archive." << std::endl;
+			isRunning = false;
+			return;
+		}
+		layoutTitleScreen();
+		markStartup("font loaded");
+		isFontLoaded = true;
+	}
+}
+
+void Game::waitForFont()
+{
+	if (!fontLoading.valid())
+		return;
+
+	fontLoading.wait();
+	updateFontLoading();
+}
+
+void Game::playMusic()
+{
+	if (!isMusicChecked)
+	{
+		// Streamed straight from the mapping of the archive. The music is optional, so the game
+		// plays on without it when it wasn't packed, and it's only looked up once
+		isMusicChecked = true;
+		const AssetArchive::Asset track = assets.find(MUSIC_NAME);
+		isMusicOpen = track.data && music.openFromMemory(track.data, track.size);
+		if (isMusicOpen)
+			music.setLooping(true);
+		else if (track.data)
+			std::cerr << "Error: Failed to open the music " << MUSIC_NAME << " from the asset archive." << std::endl;
+	}
+	if (!isMusicOpen)
+		return;
+	musicVolume = 0.f;
+	music.setVolume(musicVolume);
+	music.play();
+}
+
+void Game::markStartup(std::string_view step)
+{
+	const std::lock_guard<std::mutex> lock(startupMutex);
+	startupSteps.emplace_back(step, InputHandler::Clock::now());
 }
 
 void Game::updateTitleColor(float fixedTimeStep)
@@ -480,8 +908,8 @@ void Game::updateTitleColor(float fixedTimeStep)
 	titleColorTimer += fixedTimeStep;
 	float t = std::min(titleColorTimer / titleColorTransitionTime, 1.f);
 
-	sf::Color start = Tetromino::COLORS.at(currentColorIndex);
-	sf::Color end = Tetromino::COLORS.at((currentColorIndex + 1) % Tetromino::COLORS.size());
+	sf::Color start = BoardRenderer::COLORS.at(currentColorIndex);
+	sf::Color end = BoardRenderer::COLORS.at((currentColorIndex + 1) % BoardRenderer::COLORS.size());
 	sf::Color interpolated = Utility::lerpColor(start, end, t);
 
 	titleScreenTitle.setOutlineColor(interpolated); // assuming `titleText` is your sf::Text
@@ -489,7 +917,7 @@ void Game::updateTitleColor(float fixedTimeStep)
 	if (t >= 1.f)
 	{
 		titleColorTimer = 0.f;
-		currentColorIndex = (currentColorIndex + 1) % Tetromino::COLORS.size();
+		currentColorIndex = (currentColorIndex + 1) % BoardRenderer::COLORS.size();
 	}
 }
 
@@ -502,133 +930,59 @@ void Game::pulseTitleText(float fixedTimeStep)
 	titleScreenText.setScale({ scale, scale });
 }
 
-int Game::getScoreWorth(unsigned linesCleared)
-{
-	if (linesCleared < 1 || linesCleared > 4)
-		return 0;
-
-	return baseScoresPerLine.at(static_cast<size_t>(linesCleared - 1)) * (level + 1);
-}
-
-bool Game::isGameOver() const
-{
-	for (unsigned x = 0; x < Grid::WIDTH; ++x)
-	{
-		if (grid.isCellFilled({ x, 0 }))
-			return true;
-	}
-	return false;
-}
-
-void Game::updateTetrominoMovement(float fixedTimeStep)
+void Game::handleSimulationEvents()
 {
-	/* INPUT */
-	// If held key was just changed or a key was just pressed
-	/*if (heldKeyLastFrame != heldKey && heldKey != HeldKey::None)
+	if (simulation.hasEvent(Simulation::GAME_OVER))
 	{
-		inputTimer = 0.f;
-		hasInitialDelayPassed = false;
-
-		if (heldKey == HeldKey::Left)
-			currentTetromino.tryMove({ -1, 0 }, grid);
-		else if (heldKey == HeldKey::Right)
-			currentTetromino.tryMove({ 1, 0 }, grid);
-		else if (heldKey == HeldKey::Down)
-			if (!currentTetromino.tryMove({ 0, 1 }, grid))
-				hasTetrominoCollidedDownward = true;
-
-		currentTetromino.updateDrawPosition();
-	}*/
-	// If a key is held down
-	if (heldKey != HeldKey::None)
-	{
-		inputTimer += fixedTimeStep;
+		gameState = GameState::GameOver;
+		soundManager.playSound(SoundManager::SoundID::GAME_OVER, 0.f, 1.f, 2.5f);
 
-		// Check if the initial delay has passed and prevent movement until it has,
-		// except for the Down key, which doesn't have an initial delay
-		if (!hasInitialDelayPassed &&
-			heldKey != HeldKey::Down)
+		if (isReplaying)
 		{
-			if (inputTimer >= initialInputDelay)
-			{
-				inputTimer = 0.f;
-				hasInitialDelayPassed = true;
-			}
+			if (!replay.matches(simulation))
+				std::cerr << "Error: The replay diverged from the recorded game." << std::endl;
 		}
-		// Else, if the initial delay has passed, allow movement
 		else
 		{
-			// Time between movements must be heldInputDelay seconds
-			if (inputTimer >= heldInputDelay)
-			{
-				inputTimer = 0.f;
-
-				if (heldKey == HeldKey::Left)
-					currentTetromino.tryMove({ -1, 0 }, grid);
-				else if (heldKey == HeldKey::Right)
-					currentTetromino.tryMove({ 1, 0 }, grid);
-				else if (heldKey == HeldKey::Down)
-					if (!currentTetromino.tryMove({ 0, 1 }, grid))
-						hasTetrominoCollidedDownward = true;
-
-				currentTetromino.updateDrawPosition();
-			}
+			replay.finish(simulation);
+			replay.saveToFile(REPLAY_PATH);
 		}
+		return;
 	}
 
-	/* AUTOMATIC MOVEMENT */
-	// Move the tetromino down automatically every tetrominoMovementDelay seconds but only if the Down key is not held
-	if (heldKey != HeldKey::Down)
-	{
-		tetrominoMovementTimer += fixedTimeStep;
-		if (tetrominoMovementTimer >= tetrominoMovementDelay)
-		{
-			tetrominoMovementTimer = 0.f;
+	if (simulation.hasEvent(Simulation::TETROMINO_LOCKED))
+		soundManager.playSound(SoundManager::SoundID::COLLISION, 0.25f, 3.5f, 0.3f);
 
-			if (!currentTetromino.tryMove({ 0, 1 }, grid))
-				hasTetrominoCollidedDownward = true;
+	if (simulation.hasEvent(Simulation::LINES_CLEARED))
+	{
+		if (simulation.hasEvent(Simulation::LEVEL_UP))
+			soundManager.playSoundAtPitch(SoundManager::SoundID::LEVEL_UP, 1.0f + static_cast<float>((static_cast<int>(simulation.getLevel()) - 1) * 0.05f));
 
-			currentTetromino.updateDrawPosition();
-		}
+		soundManager.playSoundAtPitch(SoundManager::SoundID::LINE_CLEAR, 1.0f + static_cast<float>((simulation.getLastLinesCleared() - 1) * 0.25f), 1.f);
 	}
 }
 
-void Game::lockTetromino()
+std::string Game::describeState(const Snapshot& snapshot) const
 {
-	const auto& shape = currentTetromino.getShape();
-	const auto& pos = currentTetromino.position;
+	switch (snapshot.gameState)
+	{
+	case GameState::TitleScreen:
+		return "on the title screen";
 
-	for (unsigned y = 0; y < 4; ++y)
+	case GameState::InGame:
 	{
-		for (unsigned x = 0; x < 4; ++x)
-		{
-			if (shape[y][x])
-			{
-				int gridX = static_cast<int>(pos.x) + x;
-				int gridY = static_cast<int>(pos.y) + y;
-				grid.fillCell(sf::Vector2u(gridX, gridY), currentTetromino.getColor());
-			}
-		}
+		std::string state = "in game at level " + std::to_string(snapshot.level);
+		if (snapshot.isPaused)
+			state += ", paused";
+		if (snapshot.isReplaying)
+			state += ", playing a replay";
+		else if (snapshot.isAutoplayEnabled)
+			state += ", on autoplay";
+		return state;
 	}
-}
 
-void Game::generateNextTetromino()
-{
-	currentTetromino = nextTetromino;
-	currentTetromino.updateStartPosition();
-	currentTetromino.updateDrawPosition();
-	nextTetromino = generator.getNext();
-	positionNextTetromino();
-}
-
-void Game::positionNextTetromino()
-{
-	if (nextTetromino.getType() == Tetromino::Type::I)
-		nextTetromino.position = sf::Vector2f(11.5f, 1.5f);
-	else if (nextTetromino.getType() == Tetromino::Type::O)
-		nextTetromino.position = sf::Vector2f(12.5f, 2.f);
-	else
-		nextTetromino.position = sf::Vector2f(12.f, 2.f);
-
-	nextTetromino.updateDrawPosition();
+	case GameState::GameOver:
+		return "on the game over screen";
+	}
+	return "";
 }
\ No newline at end of file
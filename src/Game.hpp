@@ -3,6 +3,11 @@
 // Author: Luka Vukorepa (https://github.com/lukav1607)
 // Created: May 8, 2025
 // Description: Defines the Game class, which contains the main game loop and manages the game state.
+//              The loop runs on two threads. The main thread polls the events of the window, which
+//              has to happen on the thread that created it, and runs the simulation at its fixed
+//              tick rate along with the sounds and the music. After every step it publishes a
+//              snapshot of everything on screen through a lock-free triple buffer, which the render
+//              thread draws at the rate of the display, so a slow frame never holds up a step.
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
@@ -10,60 +15,159 @@
 
 #pragma once
 
-#include "Grid.hpp"
-#include "TetrominoGenerator.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "Core/Simulation.hpp"
+#include "Core/AutoPlayer.hpp"
+#include "Core/Replay.hpp"
+#include "Core/RewindBuffer.hpp"
+#include "BoardRenderer.hpp"
 #include "HUD.hpp"
 #include "TitleScreenShapes.hpp"
+#include "FallingTetrominoes.hpp"
 #include "SoundManager.hpp"
+#include "FrameProfiler.hpp"
+#include "InputHandler.hpp"
+#include "LatencyProbe.hpp"
+#include "AssetArchive.hpp"
+#include "TripleBuffer.hpp"
 
 class Game
 {
 public:
 	static constexpr unsigned WINDOW_WIDTH = 900U;
 	static constexpr unsigned WINDOW_HEIGHT = 1100U;
-
-	Game();
+	static constexpr std::chrono::microseconds AUTOPLAY_BUDGET{ 500 }; // Search time the bot gets per update
+	static constexpr std::int64_t MAX_CATCH_UP_STEPS = 5; // Steps simulated at once before the time behind is dropped
+	static constexpr std::chrono::milliseconds INPUT_POLL_INTERVAL{ 1 }; // Longest the simulation thread sleeps between polls of the events
+	static constexpr const char* REPLAY_PATH = "last-game.replay"; // Every finished game is recorded here
+	// Names of the assets in the archive
+	static constexpr const char* FONT_NAME = "fonts/seguisb.ttf";
+	static constexpr const char* MUSIC_NAME = "music/arcade-beat-323176.mp3";
+
+	// `startTime` is when the process started, which the startup times are measured from
+	explicit Game(InputHandler::Clock::time_point startTime = InputHandler::Clock::now());
+	// Delayed auto shift and auto repeat rate of sideways movement
+	void setRepeatTiming(std::chrono::milliseconds das, std::chrono::milliseconds arr);
+	// Play the given replay instead of a new game whenever a game is started
+	bool loadReplay(const std::string& path);
+	void setVerticalSyncEnabled(bool isEnabled);
+	// Number of fixed time steps per second; the rules count ticks, so the game speeds up or slows
+	// down along with it
+	void setTickRate(unsigned ticksPerSecond);
+	// Start a game right away and measure the input-to-photon latency with synthetic key presses,
+	// reporting it and quitting once `sampleCount` samples are collected
+	void startLatencyTest(unsigned sampleCount);
+	// Let games be stepped back by up to 30 seconds, a tick at a time, while REWIND is held
+	void setPracticeMode(bool isEnabled) { isPracticeMode = isEnabled; }
+	// Print how long the startup took until each of its steps, e.g. the first presented frame, and
+	// quit once everything is loaded
+	void showStartupTime() { isStartupTimeShown = true; }
 	int run();
 
 private:
+	enum class GameState
+	{
+		TitleScreen,
+		InGame,
+		GameOver
+	};
+
+	// Time the simulation thread spent since the start
+	struct SimulationTimes
+	{
+		std::uint64_t steps = 0u;
+		InputHandler::Clock::duration input{};
+		InputHandler::Clock::duration update{};
+		InputHandler::Clock::duration dropped{};
+	};
+
+	// Everything the render thread needs to draw the game as of the last simulation step
+	struct Snapshot
+	{
+		GameState gameState = GameState::TitleScreen;
+		bool isPaused = false;
+		bool isGameOver = false;
+		bool isIdle = false;
+		bool isProfilerShown = false;
+		bool isReplaying = false;
+		bool isAutoplayEnabled = false;
+		std::uint8_t overlayAlpha = 0u;
+		unsigned redrawCount = 0u; // Increased whenever the window has to be presented again
+		BoardRenderer::State board;
+		unsigned score = 0u;
+		unsigned level = 0u;
+		unsigned linesCleared = 0u;
+		std::uint64_t tick = 0u; // Steps taken since the start, including those of the title screen
+		InputHandler::Clock::time_point tickTime; // Time the last step ends at
+		SimulationTimes simulationTimes;
+	};
+
+	// Simulation thread
 	void processInput();
-	void update(float fixedTimeStep);
-	void render();
+	void update();
+	void handleEvent(const sf::Event& event);
+	// True when nothing on screen can change until the next window or keyboard event
+	bool isIdle() const;
+	void publishSnapshot(bool isIdle);
+	// Wake the render thread if it's waiting for a snapshot while idle
+	void wakeRenderThread();
+
+	// Render thread
+	void renderLoop();
+	// Take the changes of a new snapshot over into the drawables
+	void updateScene(const Snapshot& snapshot);
+	// Move what is interpolated to where it is at this point between the last two steps
+	void interpolate(const Snapshot& snapshot);
+	void render(const Snapshot& snapshot);
+	void renderScene(sf::RenderTarget& target, const Snapshot& snapshot);
+	// Draw a single drawable and count it; composite drawables count their own draw calls
+	void draw(sf::RenderTarget& target, const sf::Drawable& drawable);
+	// Render the current frame into a texture that is presented while the game is idle
+	void freezeFrame(const Snapshot& snapshot);
 
 	void initializeWindow();
 	void resetGame();
 
+	// Take over the sounds as their workers finish, without waiting for them
+	void updateLoading();
+	// Take over the font once its worker finishes, on the render thread
+	void updateFontLoading();
+	// Block until the font is loaded, for what can't be shown without it
+	void waitForFont();
+	void layoutTitleScreen();
+	// The pause and game over screens are laid out when the first game starts
+	void layoutGameTexts();
+	// The music is opened when it's first played
+	void playMusic();
+	// Record the time a step of the startup finished at, from either thread
+	void markStartup(std::string_view step);
+
 	void updateTitleColor(float fixedTimeStep);
 	void pulseTitleText(float fixedTimeStep);
 
-	// Calculate score based on the number of lines just cleared and the current level and return it as an int
-	int getScoreWorth(unsigned linesCleared);
-
-	bool isGameOver() const;
-
-	// Update the tetromino movement based on user input and automatic movement
-	void updateTetrominoMovement(float fixedTimeStep);
-	// Lock the tetromino in place
-	void lockTetromino();
-	// Generate the next tetromino
-	void generateNextTetromino();
-	// Position the next tetromino display to be centered on the right side of the screen
-	void positionNextTetromino();
+	// Play sounds for the events raised by the last simulation step
+	void handleSimulationEvents();
+	// What the game was doing, for the hitch log
+	std::string describeState(const Snapshot& snapshot) const;
 
-	enum class GameState
-	{
-		TitleScreen,
-		InGame,
-		GameOver
-	};
 	GameState gameState;
 
-	bool isRunning;
+	std::atomic<bool> isRunning; // Either thread can quit
 
 	bool isPaused;
 	sf::RectangleShape transparentOverlay;
 	sf::Color transparentDefaultOverlayColor;
-	int transparentOverlayAlpha;
+	int transparentOverlayAlpha; // Of the simulation thread, which fades it in
 	sf::Text pauseTitle;
 	sf::Text pauseText;
 
@@ -72,7 +176,9 @@ private:
 	sf::Text titleScreenAuthor;
 	sf::Text titleScreenAuthorShadow;
 	float titleColorTransitionTime; // seconds per transition
+	std::uint64_t animatedTick; // Last step the title screen was animated for
 	TitleScreenShapes titleScreenShapes;
+	FallingTetrominoes titleScreenTetrominoes;
 
 	sf::Text gameOverTitle;
 	sf::Text gameOverScore;
@@ -80,70 +186,60 @@ private:
 
 	sf::RenderWindow window;
 	sf::Color backgroundColor;
+	sf::RenderTexture frozenFrame;
+	bool isFrameFrozen;
+	unsigned redrawCount; // Of the simulation thread, increased when the window has to be presented again
+	unsigned presentedRedrawCount; // Of the render thread
 
-	sf::Font titleFont;
+	AssetArchive assets; // Mapped for as long as the fonts, sounds and music use it
 	sf::Font textFont;
-	HUD hud;
-
-	sf::RectangleShape topBar;
-	sf::RectangleShape topBarBottomLine;
-
-	const unsigned LINES_PER_LEVEL = 10U; // Number of lines to clear to level up
-	unsigned score;
-	unsigned level;
-	unsigned totalLinesCleared;
-
-	// Score per line cleared in a single move
-	const std::array<unsigned, 4> baseScoresPerLine =
-	{{
-		{ 40U },  // 1 line cleared
-		{ 100U }, // 2 lines cleared
-		{ 300U }, // 3 lines cleared
-		{ 1200U } // 4 lines cleared
-	}};
-
-	sf::RectangleShape nextTetrominoBox;
-
-	Grid grid;
-
-	TetrominoGenerator generator;
-	Tetromino currentTetromino, nextTetromino;
-	const float BASE_MOVEMENT_DELAY = 1.f; // Base delay between automatic tetromino movements
-	const float MINIMUM_MOVEMENT_DELAY = 0.1f; // Minimum delay between automatic tetromino movements
-	const float MOVEMENT_DELAY_DECREASE = 0.12f; // Movement delay decrease per level
-	float tetrominoMovementDelay; // Delay between automatic tetromino movements
-	float tetrominoMovementTimer; // Timer for automatic tetromino movement
-
-	bool isTetrominoWaitingForRotation;
-	bool hasTetrominoCollidedDownward;
-
-	std::vector<unsigned> filledLines; // Lines that are filled and need to be cleared
-	bool areLinesFlashing;
-	float lineFlashDuration; // Duration for flashing filled lines
-	float lineFlashInterval; // Interval between flashes
-	float lineFlashTimer; // Timer for flashing filled lines
-	float lineFlashPhaseTimer;
-	bool lineFlashPhaseSwitch;
-
-	enum class HeldKey
-	{
-		None,
-		Left,
-		Right,
-		Down
-	};
-	HeldKey heldKey;
-	HeldKey heldKeyLastFrame;
-	bool wasKeyJustPressed;
-	bool canMoveAgain;
-
-	bool hasInitialDelayPassed;
-	float initialInputDelay; // Delay before the first input is registered (not applied to Down key)
-	float heldInputDelay; // Delay between inputs while a key is held down after the initial delay
-	float inputTimer; // Timer for input delay
+	std::future<bool> fontLoading; // Loads textFont, which can't be used before it's done
+	std::atomic<bool> isFontLoaded;
+	bool areSoundsLoaded;
+	bool areGameTextsLaidOut;
+	std::optional<HUD> hud; // Created along with the first game
+	unsigned shownGameOverScore;
+
+	InputHandler::Clock::time_point startTime;
+	std::mutex startupMutex; // Guards the startup steps, which both threads record
+	std::vector<std::pair<std::string_view, InputHandler::Clock::time_point>> startupSteps;
+	bool isStartupTimeShown;
+	std::atomic<bool> isTitleScreenComplete; // A frame with the text of the title screen has been presented
+	FrameProfiler profiler;
+	SimulationTimes profiledTimes; // Already added to the frames of the profiler
+
+	TripleBuffer<Snapshot> snapshots;
+	std::atomic<std::uint64_t> publishCount; // Snapshots published, which the idle render thread waits on
+	std::mutex publishMutex;
+	std::condition_variable snapshotPublished;
+	std::uint64_t tickCount;
+	SimulationTimes simulationTimes;
+	bool isSnapshotOutdated; // Something on screen changed without a simulation step
+	bool isProfilerShown;
+
+	InputHandler inputHandler;
+	InputHandler::Clock::time_point updateTime; // Time the fixed time step being simulated ends at
+	unsigned ticksPerSecond;
+	bool isVerticalSyncEnabled;
+	LatencyProbe latencyProbe;
+
+	Simulation simulation;
+	Simulation::Input input; // Input collected since the last simulation step
+	AutoPlayer autoPlayer;
+	bool isAutoplayEnabled;
+	Replay replay; // Recording of the current game, or the loaded replay that is played back
+	Replay::Player replayPlayer;
+	bool isReplaying;
+	bool isPracticeMode;
+	RewindBuffer rewindBuffer; // States of the current game in practice mode
+	unsigned rewoundTicks; // Ticks stepped back over since the last step, which the replay is cut back by
+	BoardRenderer::State boardState; // Captured after every step
+	BoardRenderer boardRenderer;
 
 	SoundManager soundManager;
 	sf::Music music;
+	bool isMusicChecked;
+	bool isMusicOpen;
 	float baseMusicVolume;
 	float musicVolume;
 };
\ No newline at end of file
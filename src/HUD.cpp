@@ -7,41 +7,140 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <algorithm>
 #include "HUD.hpp"
-#include "Grid.hpp"
+#include "BoardRenderer.hpp"
 
 HUD::HUD(const sf::Font& font) :
-	score(font, "SCORE: 0", 32),
-	level(font, "LEVEL: 1", 32),
-	linesCleared(font, "LINES: 0", 32),
-	nextTetromino(font, "NEXT SHAPE", 30),
+	font(&font),
+	vertices(sf::VertexBuffer::Usage::Dynamic),
+	digitAdvance(0.f),
 	textColor(sf::Color(255, 245, 210))
 {
-	score.setPosition({ (Grid::WIDTH + 1) * Cell::SIZE + Grid::OFFSET.x, Grid::OFFSET.y + (Grid::HEIGHT - 4) * Cell::SIZE });
-	score.setFillColor(textColor);
-	score.setOutlineColor(sf::Color::White);
-	score.setOutlineThickness(0.5f);
-
-	level.setPosition({ (Grid::WIDTH + 1) * Cell::SIZE + Grid::OFFSET.x, Grid::OFFSET.y + (Grid::HEIGHT - 3) * Cell::SIZE + Cell::SIZE / 2});
-	level.setFillColor(textColor);
-	level.setOutlineColor(sf::Color::White);
-	level.setOutlineThickness(0.5f);
-
-	linesCleared.setPosition({ (Grid::WIDTH + 1) * Cell::SIZE + Grid::OFFSET.x, Grid::OFFSET.y + (Grid::HEIGHT - 2) * Cell::SIZE + Cell::SIZE });
-	linesCleared.setFillColor(textColor);
-	linesCleared.setOutlineColor(sf::Color::White);
-	linesCleared.setOutlineThickness(0.5f);
-
-	nextTetromino.setPosition({ (Grid::WIDTH + 1) * Cell::SIZE + Grid::OFFSET.x + 35.f, Grid::OFFSET.y });
-	nextTetromino.setFillColor(textColor);
-	nextTetromino.setOutlineColor(sf::Color::White);
-	nextTetromino.setOutlineThickness(0.5f);
+	size_t labelGlyphCount = 0u;
+	for (const auto& label : LABELS)
+		labelGlyphCount += label.size();
+
+	numbersSection = { 0u, labelGlyphCount + NUMBER_COUNT * MAX_DIGITS, CHARACTER_SIZE };
+	nextTetrominoSection = { numbersSection.getVertexCount(), NEXT_TETROMINO_LABEL.size(), NEXT_TETROMINO_CHARACTER_SIZE };
+	vertices.resize(numbersSection.getVertexCount() + nextTetrominoSection.getVertexCount());
+
+	// Bake the digits into the font texture so no glyph is rasterized while playing
+	for (char32_t digit = U'0'; digit <= U'9'; ++digit)
+	{
+		digitAdvance = std::max(digitAdvance, font.getGlyph(digit, CHARACTER_SIZE, false).advance);
+		font.getGlyph(digit, CHARACTER_SIZE, false, OUTLINE_THICKNESS);
+	}
+
+	const float left = static_cast<float>((Grid::WIDTH + 1) * BoardRenderer::CELL_SIZE + BoardRenderer::OFFSET.x);
+	const std::array<float, NUMBER_COUNT> tops =
+	{
+		static_cast<float>(BoardRenderer::OFFSET.y + (Grid::HEIGHT - 4) * BoardRenderer::CELL_SIZE),
+		static_cast<float>(BoardRenderer::OFFSET.y + (Grid::HEIGHT - 3) * BoardRenderer::CELL_SIZE + BoardRenderer::CELL_SIZE / 2),
+		static_cast<float>(BoardRenderer::OFFSET.y + (Grid::HEIGHT - 2) * BoardRenderer::CELL_SIZE + BoardRenderer::CELL_SIZE)
+	};
+
+	size_t slot = 0u;
+	for (size_t i = 0; i < NUMBER_COUNT; ++i)
+	{
+		// The baseline of sf::Text sits one character size below its position
+		digitPositions[i] = writeLabel(numbersSection, slot, LABELS[i], { left, tops[i] + CHARACTER_SIZE });
+		slot += LABELS[i].size();
+	}
+	for (size_t i = 0; i < NUMBER_COUNT; ++i)
+	{
+		firstDigitSlots[i] = slot + i * MAX_DIGITS;
+		for (size_t digit = 0; digit < MAX_DIGITS; ++digit)
+			clearGlyph(numbersSection, firstDigitSlots[i] + digit);
+		shownDigits[i].fill(0);
+	}
+	writeLabel(nextTetrominoSection, 0u, NEXT_TETROMINO_LABEL, { left + 35.f, static_cast<float>(BoardRenderer::OFFSET.y + NEXT_TETROMINO_CHARACTER_SIZE) });
+
+	updateScore(0);
+	updateLevel(1);
+	updateLinesCleared(0);
 }
 
 void HUD::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
-	target.draw(score, states);
-	target.draw(level, states);
-	target.draw(linesCleared, states);
-	target.draw(nextTetromino, states);
+	states.texture = &font->getTexture(numbersSection.characterSize);
+	vertices.draw(target, states, numbersSection.first, numbersSection.getVertexCount());
+
+	states.texture = &font->getTexture(nextTetrominoSection.characterSize);
+	vertices.draw(target, states, nextTetrominoSection.first, nextTetrominoSection.getVertexCount());
+}
+
+sf::Vector2f HUD::writeLabel(const Section& section, size_t slot, std::string_view label, sf::Vector2f penPosition)
+{
+	char32_t previous = 0;
+	for (size_t i = 0; i < label.size(); ++i)
+	{
+		const char32_t character = static_cast<char32_t>(label[i]);
+		penPosition.x += font->getKerning(previous, character, section.characterSize);
+		previous = character;
+
+		if (character == U' ')
+			clearGlyph(section, slot + i);
+		else
+			writeGlyph(section, slot + i, character, penPosition);
+		penPosition.x += font->getGlyph(character, section.characterSize, false).advance;
+	}
+	return penPosition;
+}
+
+void HUD::writeGlyph(const Section& section, size_t slot, char32_t character, sf::Vector2f penPosition)
+{
+	// Same quads as sf::Text, which pads every glyph by a pixel on each side
+	const sf::Vector2f padding(1.f, 1.f);
+	auto toQuad = [&](const sf::Glyph& glyph, size_t first, sf::Color color)
+		{
+			const sf::FloatRect rect(penPosition + glyph.bounds.position - padding, glyph.bounds.size + 2.f * padding);
+			const sf::FloatRect textureRect(sf::Vector2f(glyph.textureRect.position) - padding, sf::Vector2f(glyph.textureRect.size) + 2.f * padding);
+			vertices.writeTexturedQuad(first, rect, textureRect, color);
+		};
+
+	toQuad(font->getGlyph(character, section.characterSize, false, OUTLINE_THICKNESS), section.getOutlineVertex(slot), sf::Color::White);
+	toQuad(font->getGlyph(character, section.characterSize, false), section.getFillVertex(slot), textColor);
+}
+
+void HUD::clearGlyph(const Section& section, size_t slot)
+{
+	vertices.writeQuad(section.getOutlineVertex(slot), {}, {}, sf::Color::Transparent);
+	vertices.writeQuad(section.getFillVertex(slot), {}, {}, sf::Color::Transparent);
+}
+
+void HUD::writeNumber(Number number, int value)
+{
+	// Digits from least to most significant, written without building a string
+	std::array<char32_t, MAX_DIGITS> digits;
+	size_t digitCount = 0u;
+	unsigned remaining = static_cast<unsigned>(std::max(value, 0));
+	do
+	{
+		digits[digitCount++] = U'0' + remaining % 10u;
+		remaining /= 10u;
+	} while (remaining > 0u && digitCount < MAX_DIGITS);
+
+	// Only the slots whose digit changed are rewritten
+	std::array<char32_t, MAX_DIGITS>& shown = shownDigits[number];
+	const size_t firstSlot = firstDigitSlots[number];
+	for (size_t i = 0; i < MAX_DIGITS; ++i)
+	{
+		const char32_t digit = i < digitCount ? digits[digitCount - 1 - i] : 0;
+		if (digit == shown[i])
+			continue;
+
+		shown[i] = digit;
+		if (digit != 0)
+		{
+			// Center each digit in its slot so the number doesn't shift as its digits change
+			const float centering = (digitAdvance - font->getGlyph(digit, CHARACTER_SIZE, false).advance) / 2.f;
+			writeGlyph(numbersSection, firstSlot + i, digit, { digitPositions[number].x + i * digitAdvance + centering, digitPositions[number].y });
+		}
+		else
+		{
+			clearGlyph(numbersSection, firstSlot + i);
+		}
+	}
+	vertices.upload();
 }
\ No newline at end of file
@@ -3,7 +3,10 @@
 // Author: Luka Vukorepa (https://github.com/lukav1607)
 // Created: May 9, 2025
 // Description: Defines the HUD class, which is responsible for displaying the game information
-//              such as score, level, and lines cleared on the screen.
+//              such as score, level, and lines cleared on the screen. The glyphs it needs are baked
+//              into the font's texture up front, and the text is kept in a vertex layer: the labels
+//              are written once, and each number owns a row of fixed-width digit slots that are
+//              rewritten in place, so updating a number never allocates or rebuilds any text.
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
@@ -11,7 +14,9 @@
 
 #pragma once
 
-#include <SFML/Graphics.hpp>
+#include <array>
+#include <string_view>
+#include "VertexLayer.hpp"
 
 class HUD : public sf::Drawable
 {
@@ -19,15 +24,49 @@ public:
 	HUD(const sf::Font& font);
 	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
-	inline void updateScore(int score) { this->score.setString("SCORE: " + std::to_string(score)); }
-	inline void updateLevel(int level) { this->level.setString("LEVEL: " + std::to_string(level)); }
-	inline void updateLinesCleared(int linesCleared) { this->linesCleared.setString("LINES: " + std::to_string(linesCleared)); }
+	inline void updateScore(int score) { writeNumber(SCORE, score); }
+	inline void updateLevel(int level) { writeNumber(LEVEL, level); }
+	inline void updateLinesCleared(int linesCleared) { writeNumber(LINES_CLEARED, linesCleared); }
 
 private:
-	sf::Text score;
-	sf::Text level;
-	sf::Text linesCleared;
-	sf::Text nextTetromino;
+	static constexpr unsigned CHARACTER_SIZE = 32u;
+	static constexpr unsigned NEXT_TETROMINO_CHARACTER_SIZE = 30u;
+	static constexpr float OUTLINE_THICKNESS = 0.5f;
+	static constexpr size_t MAX_DIGITS = 10u; // Enough for any int
+
+	enum Number { SCORE, LEVEL, LINES_CLEARED, NUMBER_COUNT };
+	static constexpr std::array<std::string_view, NUMBER_COUNT> LABELS = { "SCORE: ", "LEVEL: ", "LINES: " };
+	static constexpr std::string_view NEXT_TETROMINO_LABEL = "NEXT SHAPE";
+
+	// Glyphs that share a character size, and so a font texture, are drawn together. Every glyph slot
+	// has an outline quad and a fill quad, and all outlines are drawn before the fills like sf::Text does.
+	struct Section
+	{
+		size_t first;
+		size_t glyphCount;
+		unsigned characterSize;
+
+		size_t getOutlineVertex(size_t slot) const { return first + slot * VertexLayer::VERTICES_PER_QUAD; }
+		size_t getFillVertex(size_t slot) const { return first + (glyphCount + slot) * VertexLayer::VERTICES_PER_QUAD; }
+		size_t getVertexCount() const { return 2u * glyphCount * VertexLayer::VERTICES_PER_QUAD; }
+	};
+
+	// Write a label starting at the given slot and return the pen position after it
+	sf::Vector2f writeLabel(const Section& section, size_t slot, std::string_view label, sf::Vector2f penPosition);
+	// Write a glyph with its baseline at the pen position
+	void writeGlyph(const Section& section, size_t slot, char32_t character, sf::Vector2f penPosition);
+	void clearGlyph(const Section& section, size_t slot);
+	void writeNumber(Number number, int value);
+
+	const sf::Font* font;
+	VertexLayer vertices;
+	Section numbersSection; // Labels and digits of the numbers
+	Section nextTetrominoSection;
+
+	std::array<size_t, NUMBER_COUNT> firstDigitSlots;
+	std::array<sf::Vector2f, NUMBER_COUNT> digitPositions; // Pen position of the first digit slot
+	std::array<std::array<char32_t, MAX_DIGITS>, NUMBER_COUNT> shownDigits; // 0 for an empty slot
+	float digitAdvance; // Width of a digit slot, the widest digit of the font
 
 	sf::Color textColor;
 };
\ No newline at end of file
@@ -0,0 +1,272 @@
+// ================================================================================================
+// File: InputHandler.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <cstdlib>
+#include "InputHandler.hpp"
+
+namespace
+{
+	// Action bound to a key, ACTION_COUNT if there is none
+	InputHandler::Action getKeyAction(sf::Keyboard::Key key)
+	{
+		switch (key)
+		{
+		case sf::Keyboard::Key::Left:
+		case sf::Keyboard::Key::A:
+			return InputHandler::LEFT;
+		case sf::Keyboard::Key::Right:
+		case sf::Keyboard::Key::D:
+			return InputHandler::RIGHT;
+		case sf::Keyboard::Key::Down:
+		case sf::Keyboard::Key::S:
+			return InputHandler::SOFT_DROP;
+		case sf::Keyboard::Key::Space:
+			return InputHandler::HARD_DROP;
+		case sf::Keyboard::Key::Up:
+		case sf::Keyboard::Key::W:
+		case sf::Keyboard::Key::R:
+			return InputHandler::ROTATE_CW;
+		case sf::Keyboard::Key::Z:
+		case sf::Keyboard::Key::Q:
+			return InputHandler::ROTATE_CCW;
+		case sf::Keyboard::Key::X:
+		case sf::Keyboard::Key::E:
+			return InputHandler::ROTATE_180;
+		case sf::Keyboard::Key::P:
+			return InputHandler::PAUSE;
+		case sf::Keyboard::Key::Enter:
+			return InputHandler::CONFIRM;
+		case sf::Keyboard::Key::Escape:
+			return InputHandler::BACK;
+		case sf::Keyboard::Key::Backspace:
+			return InputHandler::REWIND;
+		case sf::Keyboard::Key::F1:
+			return InputHandler::AUTOPLAY;
+		case sf::Keyboard::Key::F3:
+			return InputHandler::PROFILER;
+		default:
+			return InputHandler::ACTION_COUNT;
+		}
+	}
+
+	// Buttons in the usual Xbox layout: A, B, X, Y, LB, RB, Back, Start
+	InputHandler::Action getButtonAction(unsigned button)
+	{
+		switch (button)
+		{
+		case 0u: return InputHandler::ROTATE_CW;
+		case 1u: return InputHandler::ROTATE_CCW;
+		case 2u: return InputHandler::ROTATE_180;
+		case 3u: return InputHandler::HARD_DROP;
+		case 4u: return InputHandler::REWIND;
+		case 6u: return InputHandler::BACK;
+		case 7u: return InputHandler::PAUSE;
+		default: return InputHandler::ACTION_COUNT;
+		}
+	}
+
+	// Index of a stick or hat axis in the joystick directions, even for horizontal axes, or -1 for
+	// axes that aren't used
+	int getAxisIndex(sf::Joystick::Axis axis)
+	{
+		switch (axis)
+		{
+		case sf::Joystick::Axis::X: return 0;
+		case sf::Joystick::Axis::Y: return 1;
+		case sf::Joystick::Axis::PovX: return 2;
+		case sf::Joystick::Axis::PovY: return 3;
+		default: return -1;
+		}
+	}
+}
+
+InputHandler::InputHandler() :
+	das(DEFAULT_DAS),
+	arr(DEFAULT_ARR),
+	holdCounts{},
+	pressCounts{},
+	isKeyDown{},
+	isButtonDown{},
+	joystickDirections{},
+	shiftDirection(0),
+	pendingShift(0)
+{
+}
+
+void InputHandler::setRepeatTiming(std::chrono::milliseconds das, std::chrono::milliseconds arr)
+{
+	this->das = das;
+	this->arr = arr;
+}
+
+void InputHandler::handleEvent(const sf::Event& event, Clock::time_point time)
+{
+	if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>())
+	{
+		// Key repeat from the OS is ignored, holding a key is tracked here
+		const int key = static_cast<int>(keyPressed->code);
+		if (key < 0 || isKeyDown[key])
+			return;
+		isKeyDown[key] = true;
+		press(getKeyAction(keyPressed->code), time);
+	}
+	else if (const auto* keyReleased = event.getIf<sf::Event::KeyReleased>())
+	{
+		const int key = static_cast<int>(keyReleased->code);
+		if (key < 0 || !isKeyDown[key])
+			return;
+		isKeyDown[key] = false;
+		release(getKeyAction(keyReleased->code), time);
+	}
+	else if (const auto* buttonPressed = event.getIf<sf::Event::JoystickButtonPressed>())
+	{
+		bool& isDown = isButtonDown[buttonPressed->joystickId][buttonPressed->button];
+		if (isDown)
+			return;
+		isDown = true;
+		press(getButtonAction(buttonPressed->button), time);
+	}
+	else if (const auto* buttonReleased = event.getIf<sf::Event::JoystickButtonReleased>())
+	{
+		bool& isDown = isButtonDown[buttonReleased->joystickId][buttonReleased->button];
+		if (!isDown)
+			return;
+		isDown = false;
+		release(getButtonAction(buttonReleased->button), time);
+	}
+	else if (const auto* joystickMoved = event.getIf<sf::Event::JoystickMoved>())
+	{
+		const int axis = getAxisIndex(joystickMoved->axis);
+		if (axis < 0)
+			return;
+
+		int direction = joystickMoved->position <= -JOYSTICK_THRESHOLD ? -1 : joystickMoved->position >= JOYSTICK_THRESHOLD ? 1 : 0;
+		// The hat reports up as positive, unlike the stick
+		if (joystickMoved->axis == sf::Joystick::Axis::PovY)
+			direction = -direction;
+		setJoystickDirection(joystickMoved->joystickId, static_cast<unsigned>(axis), direction, time);
+	}
+	else if (const auto* joystickDisconnected = event.getIf<sf::Event::JoystickDisconnected>())
+	{
+		const unsigned joystick = joystickDisconnected->joystickId;
+		for (unsigned button = 0; button < sf::Joystick::ButtonCount; ++button)
+		{
+			if (isButtonDown[joystick][button])
+			{
+				isButtonDown[joystick][button] = false;
+				release(getButtonAction(button), time);
+			}
+		}
+		for (unsigned axis = 0; axis < JOYSTICK_DIRECTION_COUNT; ++axis)
+			setJoystickDirection(joystick, axis, 0, time);
+	}
+}
+
+void InputHandler::releaseAll()
+{
+	holdCounts.fill(0u);
+	isKeyDown.fill(false);
+	for (auto& buttons : isButtonDown)
+		buttons.fill(false);
+	for (auto& directions : joystickDirections)
+		directions.fill(0);
+	shiftDirection = 0;
+}
+
+bool InputHandler::consumePress(Action action)
+{
+	if (pressCounts[action] == 0u)
+		return false;
+
+	--pressCounts[action];
+	return true;
+}
+
+int InputHandler::consumeShift(Clock::time_point time)
+{
+	int shift = pendingShift;
+	pendingShift = 0;
+
+	if (shiftDirection != 0)
+	{
+		if (arr.count() == 0)
+		{
+			if (nextRepeat <= time)
+				shift += shiftDirection * MAX_SHIFT;
+		}
+		else
+		{
+			for (; nextRepeat <= time && std::abs(shift) < MAX_SHIFT; nextRepeat += arr)
+				shift += shiftDirection;
+			// Repeats past the wall are dropped rather than owed to the following ticks
+			if (nextRepeat <= time)
+				nextRepeat += ((time - nextRepeat) / arr + 1) * arr;
+		}
+	}
+	return std::clamp(shift, -MAX_SHIFT, MAX_SHIFT);
+}
+
+void InputHandler::restartRepeat(Clock::time_point time)
+{
+	nextRepeat = time + das;
+}
+
+void InputHandler::press(Action action, Clock::time_point time)
+{
+	if (action == ACTION_COUNT || holdCounts[action]++ > 0u)
+		return;
+
+	++pressCounts[action];
+
+	// The latest direction pressed wins and moves one column at once
+	if (action == LEFT || action == RIGHT)
+	{
+		shiftDirection = action == LEFT ? -1 : 1;
+		pendingShift += shiftDirection;
+		nextRepeat = time + das;
+	}
+}
+
+void InputHandler::release(Action action, Clock::time_point time)
+{
+	if (action == ACTION_COUNT || holdCounts[action] == 0u || --holdCounts[action] > 0u)
+		return;
+
+	// Releasing the repeating direction hands it over to the other one if that's still held,
+	// which starts repeating after the full delay without moving at once
+	if ((action == LEFT && shiftDirection < 0) || (action == RIGHT && shiftDirection > 0))
+	{
+		const Action other = action == LEFT ? RIGHT : LEFT;
+		shiftDirection = isHeld(other) ? -shiftDirection : 0;
+		nextRepeat = time + das;
+	}
+}
+
+void InputHandler::setJoystickDirection(unsigned joystick, unsigned axis, int direction, Clock::time_point time)
+{
+	int& current = joystickDirections[joystick][axis];
+	if (current == direction)
+		return;
+
+	// Horizontal axes move sideways, vertical ones only soft drop when pushed down
+	const bool isHorizontal = axis % 2u == 0u;
+	const auto getAction = [isHorizontal](int direction)
+		{
+			if (isHorizontal)
+				return direction < 0 ? LEFT : RIGHT;
+			return direction > 0 ? SOFT_DROP : ACTION_COUNT;
+		};
+
+	if (current != 0)
+		release(getAction(current), time);
+	current = direction;
+	if (current != 0)
+		press(getAction(current), time);
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+// ================================================================================================
+// File: InputHandler.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the InputHandler class, which turns the keyboard and joystick events of the
+//              window into game actions. Every event is stamped with the time it was polled from a
+//              monotonic clock, and actions fire on press rather than on release. Sideways movement
+//              uses delayed auto shift (DAS) and auto repeat rate (ARR) configured in milliseconds:
+//              a press moves at once, and while it's held the repeats are scheduled from the time of
+//              the press. They are handed out to the fixed time steps that cover them, so the repeat
+//              timing doesn't depend on the tick rate and several repeats can land in a single tick.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <SFML/Window.hpp>
+
+class InputHandler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	enum Action
+	{
+		LEFT,
+		RIGHT,
+		SOFT_DROP,
+		HARD_DROP,
+		ROTATE_CW,
+		ROTATE_CCW,
+		ROTATE_180,
+		PAUSE,
+		CONFIRM,
+		BACK,
+		REWIND,
+		AUTOPLAY,
+		PROFILER,
+		ACTION_COUNT
+	};
+
+	static constexpr std::chrono::milliseconds DEFAULT_DAS{ 150 };
+	static constexpr std::chrono::milliseconds DEFAULT_ARR{ 50 };
+	static constexpr float JOYSTICK_THRESHOLD = 50.f; // Axis position at which a stick or hat counts as pressed
+
+	InputHandler();
+
+	// Delay before a held direction starts repeating and time between repeats; an ARR of 0 shifts
+	// all the way to the wall on every tick once the delay has passed
+	void setRepeatTiming(std::chrono::milliseconds das, std::chrono::milliseconds arr);
+
+	void handleEvent(const sf::Event& event, Clock::time_point time);
+	// Release everything, for when the window can no longer see the matching release events
+	void releaseAll();
+
+	// True if the action was pressed since the presses were last cleared, consuming the press
+	bool consumePress(Action action);
+	// Forget the presses no one consumed, so they don't fire later in another state of the game
+	void clearPresses() { pressCounts.fill(0u); }
+	bool isHeld(Action action) const { return holdCounts[action] > 0u; }
+
+	// Sideways moves due up to the given time, negative to the left
+	int consumeShift(Clock::time_point time);
+	// Restart the repeat delay of a held direction, e.g. after time that isn't played such as a pause
+	void restartRepeat(Clock::time_point time);
+
+private:
+	static constexpr int MAX_SHIFT = 10; // Enough to reach the wall from anywhere in the grid
+	static constexpr unsigned JOYSTICK_DIRECTION_COUNT = 4u; // X, Y, hat X and hat Y
+
+	void press(Action action, Clock::time_point time);
+	void release(Action action, Clock::time_point time);
+	// Set the direction the stick or hat axis points to, pressing and releasing its actions
+	void setJoystickDirection(unsigned joystick, unsigned axis, int direction, Clock::time_point time);
+
+	std::chrono::microseconds das;
+	std::chrono::microseconds arr;
+
+	// Number of keys and buttons holding each action, so that two keys bound to the same action
+	// don't release it while one of them is still held
+	std::array<unsigned, ACTION_COUNT> holdCounts;
+	std::array<unsigned, ACTION_COUNT> pressCounts;
+	std::array<bool, sf::Keyboard::KeyCount> isKeyDown;
+	std::array<std::array<bool, sf::Joystick::ButtonCount>, sf::Joystick::Count> isButtonDown;
+	std::array<std::array<int, JOYSTICK_DIRECTION_COUNT>, sf::Joystick::Count> joystickDirections;
+
+	// Sideways movement
+	int shiftDirection; // Direction that is held and repeats, -1 left, 1 right or 0
+	int pendingShift; // Moves from presses that no tick has taken yet
+	Clock::time_point nextRepeat; // Time of the next auto-repeat move of the held direction
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+// ================================================================================================
+// File: LatencyProbe.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include "LatencyProbe.hpp"
+
+namespace
+{
+	std::uint32_t toMicroseconds(LatencyProbe::Clock::duration duration)
+	{
+		return static_cast<std::uint32_t>(std::max<long long>(0, std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+	}
+}
+
+LatencyProbe::LatencyProbe() :
+	sampleCount(0u),
+	discardedCount(0u),
+	state(State::Waiting),
+	key(sf::Keyboard::Key::Left),
+	baseline(0),
+	changeTick(NO_TICK),
+	rng(std::random_device{}()),
+	watchedTick(NO_TICK),
+	presentedTick(NO_TICK),
+	presentTime(0),
+	frameCount(0u),
+	firstFrameTime(0),
+	lastFrameTime(0)
+{
+}
+
+void LatencyProbe::start(unsigned sampleCount)
+{
+	this->sampleCount = sampleCount;
+	samples.clear();
+	samples.reserve(sampleCount);
+	discardedCount = 0u;
+	scheduleNextPress(Clock::now());
+	frameCount = 0u;
+}
+
+std::optional<sf::Event> LatencyProbe::takeEvent(Clock::time_point now, int value)
+{
+	if (!isRunning() || isFinished())
+		return std::nullopt;
+
+	if (state == State::Changed && presentedTick.load(std::memory_order_acquire) == changeTick)
+		finishSample(Clock::time_point(Clock::duration(presentTime.load(std::memory_order_relaxed))));
+
+	if (state == State::Pressed && now - pressTime > TIMEOUT)
+	{
+		// Blocked by the stack or the wall
+		++discardedCount;
+		state = State::Releasing;
+	}
+
+	if (state == State::Releasing)
+	{
+		sf::Event::KeyReleased keyReleased{};
+		keyReleased.code = key;
+		key = key == sf::Keyboard::Key::Left ? sf::Keyboard::Key::Right : sf::Keyboard::Key::Left;
+		scheduleNextPress(now);
+		return sf::Event(keyReleased);
+	}
+
+	// A press that was due while the game couldn't take input, e.g. while paused, would be
+	// measured as waiting for the poll all that time
+	if (state == State::Waiting && now - pressTime > TIMEOUT)
+		scheduleNextPress(now);
+
+	if (state == State::Waiting && now >= pressTime)
+	{
+		// The key went down at pressTime and waited in the event queue until this poll
+		sf::Event::KeyPressed keyPressed{};
+		keyPressed.code = key;
+		baseline = value;
+		pollTime = now;
+		state = State::Pressed;
+		return sf::Event(keyPressed);
+	}
+	return std::nullopt;
+}
+
+void LatencyProbe::observe(int value, bool isInvalidated, Clock::time_point now, std::uint64_t tick)
+{
+	if (state != State::Pressed)
+		return;
+
+	if (isInvalidated)
+	{
+		++discardedCount;
+		state = State::Releasing;
+	}
+	else if (value != baseline)
+	{
+		changeTime = now;
+		changeTick = tick;
+		state = State::Changed;
+		watchedTick.store(tick, std::memory_order_release);
+	}
+}
+
+void LatencyProbe::markPresented(Clock::time_point now, std::uint64_t tick)
+{
+	if (!isRunning())
+		return;
+
+	if (frameCount.fetch_add(1u, std::memory_order_relaxed) == 0u)
+		firstFrameTime.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+	lastFrameTime.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+
+	// Only the first frame with the change counts, and the simulation thread watches for a new change
+	// only once it has taken the time of this one
+	const std::uint64_t watched = watchedTick.load(std::memory_order_acquire);
+	if (watched != NO_TICK && tick >= watched && presentedTick.load(std::memory_order_relaxed) != watched)
+	{
+		presentTime.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+		presentedTick.store(watched, std::memory_order_release);
+	}
+}
+
+void LatencyProbe::report(std::ostream& stream, std::string_view settings) const
+{
+	char line[128];
+	const unsigned long long frames = frameCount.load(std::memory_order_relaxed);
+	const Clock::duration framesTime(lastFrameTime.load(std::memory_order_relaxed) - firstFrameTime.load(std::memory_order_relaxed));
+	const double frameTime = frames > 1u ? std::chrono::duration<double, std::milli>(framesTime).count() / (frames - 1u) : 0.0;
+	std::snprintf(line, sizeof(line), "Input-to-photon latency, %zu samples (%u discarded), %.2f ms per frame, ", samples.size(), discardedCount, frameTime);
+	stream << line << settings << "\n";
+	stream << "Delay        min      p50      p95      p99      max     mean (ms)\n";
+
+	std::vector<std::uint32_t> values(samples.size());
+	for (unsigned delay = 0u; delay < DELAY_COUNT; ++delay)
+	{
+		if (values.empty())
+			break;
+
+		double sum = 0.0;
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			values[i] = samples[i][delay];
+			sum += values[i];
+		}
+		std::sort(values.begin(), values.end());
+
+		const auto getPercentile = [&values](size_t percent) { return values[(values.size() - 1u) * percent / 100u] / 1000.0; };
+		std::snprintf(line, sizeof(line), "%-8s %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+			DELAY_NAMES[delay].data(), values.front() / 1000.0, getPercentile(50u), getPercentile(95u), getPercentile(99u), values.back() / 1000.0, sum / values.size() / 1000.0);
+		stream << line;
+	}
+	stream.flush();
+}
+
+void LatencyProbe::scheduleNextPress(Clock::time_point now)
+{
+	// The next press lands at a random time, so it's as likely to fall early in a frame as late
+	std::uniform_int_distribution<long long> interval(std::chrono::microseconds(MIN_INTERVAL).count(), std::chrono::microseconds(MAX_INTERVAL).count());
+	pressTime = now + std::chrono::microseconds(interval(rng));
+	state = State::Waiting;
+}
+
+void LatencyProbe::finishSample(Clock::time_point now)
+{
+	Sample sample;
+	sample[POLL] = toMicroseconds(pollTime - pressTime);
+	sample[UPDATE] = toMicroseconds(changeTime - pollTime);
+	sample[PRESENT] = toMicroseconds(now - changeTime);
+	sample[TOTAL] = toMicroseconds(now - pressTime);
+	samples.push_back(sample);
+	state = State::Releasing;
+	watchedTick.store(NO_TICK, std::memory_order_relaxed);
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+// ================================================================================================
+// File: LatencyProbe.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the LatencyProbe class, which measures the input-to-photon latency of the
+//              game loop. It injects synthetic key presses into the same input path as the window
+//              events, each one scheduled for a known time at a random phase of the frame, and
+//              follows it until the state change it causes has been presented, i.e. until
+//              window.display() returns with it on screen. Every sample is split into the three
+//              delays of the loop: waiting for the next poll of the events, waiting for the fixed
+//              time step that applies the input, and rendering and presenting the frame (including
+//              the wait for the vertical sync). The distributions are reported once enough samples
+//              are collected. What the OS, the compositor and the display add on top isn't seen.
+//              The frames are presented by the render thread, which hands the time the change was
+//              first presented at back to the simulation thread through atomics.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <string_view>
+#include <vector>
+#include <SFML/Window.hpp>
+
+class LatencyProbe
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	enum Delay { POLL, UPDATE, PRESENT, TOTAL, DELAY_COUNT };
+
+	static constexpr std::chrono::milliseconds MIN_INTERVAL{ 100 }; // Time between the release of a key and the next press
+	static constexpr std::chrono::milliseconds MAX_INTERVAL{ 300 };
+	static constexpr std::chrono::milliseconds TIMEOUT{ 1000 }; // Presses that change nothing for this long are discarded
+
+	// Delays of a single press in microseconds
+	using Sample = std::array<std::uint32_t, DELAY_COUNT>;
+
+	LatencyProbe();
+
+	// Start injecting presses until `sampleCount` samples are collected
+	void start(unsigned sampleCount);
+	bool isRunning() const { return sampleCount > 0u; }
+	bool isFinished() const { return isRunning() && samples.size() >= sampleCount; }
+
+	// Synthetic key event that is due at the given time, if any. A press is expected to change
+	// `value`, e.g. the column of the current tetromino, which is watched through observe().
+	std::optional<sf::Event> takeEvent(Clock::time_point now, int value);
+	// Called after every simulation step with the watched value and the number of the step;
+	// `isInvalidated` discards the sample being measured, e.g. when the tetromino locked and a new
+	// one took its place
+	void observe(int value, bool isInvalidated, Clock::time_point now, std::uint64_t tick);
+	// Called by the render thread right after window.display() returns, with the number of the last
+	// simulation step shown in the frame
+	void markPresented(Clock::time_point now, std::uint64_t tick);
+
+	// Distribution of every delay, along with the settings the samples were taken with
+	void report(std::ostream& stream, std::string_view settings) const;
+
+private:
+	static constexpr std::array<std::string_view, DELAY_COUNT> DELAY_NAMES = { "Poll", "Update", "Present", "Total" };
+	static constexpr std::uint64_t NO_TICK = ~std::uint64_t(0);
+
+	enum class State
+	{
+		Waiting,  // For the time of the next press
+		Pressed,  // For the press to change the watched value
+		Changed,  // For the change to be presented
+		Releasing // For the release of the key to be injected
+	};
+
+	void scheduleNextPress(Clock::time_point now);
+	void finishSample(Clock::time_point now);
+
+	unsigned sampleCount;
+	std::vector<Sample> samples;
+	unsigned discardedCount;
+
+	State state;
+	sf::Keyboard::Key key; // Alternates between left and right, so the tetromino stays clear of the walls
+	int baseline;
+	Clock::time_point pressTime; // When the key was "pressed", which can be before it's polled
+	Clock::time_point pollTime;
+	Clock::time_point changeTime;
+	std::uint64_t changeTick; // Step that changed the watched value
+	std::mt19937 rng;
+
+	// Written by the simulation thread once the watched value changed, then by the render thread
+	// once a frame showing the change is presented
+	std::atomic<std::uint64_t> watchedTick;
+	std::atomic<std::uint64_t> presentedTick;
+	std::atomic<Clock::rep> presentTime;
+
+	// Presented frames, for the average frame time
+	std::atomic<unsigned long long> frameCount;
+	std::atomic<Clock::rep> firstFrameTime;
+	std::atomic<Clock::rep> lastFrameTime;
+};
\ No newline at end of file
@@ -0,0 +1,31 @@
+// ================================================================================================
+// File: RenderStats.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the RenderStats namespace, which counts the draw calls issued to the window
+//              every frame so the cost of the rendering code can be tracked. The counts are
+//              atomic, so they can be read from any thread while the render thread draws.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <atomic>
+
+namespace RenderStats
+{
+	// Draw calls issued during the current frame
+	inline std::atomic<unsigned> drawCalls{ 0u };
+	// Draw calls issued during the last completed frame
+	inline std::atomic<unsigned> lastFrameDrawCalls{ 0u };
+
+	inline void countDrawCall(unsigned count = 1u) { drawCalls.fetch_add(count, std::memory_order_relaxed); }
+
+	// Store the count of the frame that just ended and start counting the next one
+	inline void endFrame()
+	{
+		lastFrameDrawCalls.store(drawCalls.exchange(0u, std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
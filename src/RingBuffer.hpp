@@ -0,0 +1,46 @@
+// ================================================================================================
+// File: RingBuffer.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the RingBuffer class, a fixed-size buffer that keeps the last CAPACITY values
+//              pushed into it, without allocating. It isn't synchronized: values are read on the
+//              thread that pushes them, e.g. the frame samples of the render thread, since a reader
+//              on another thread could see a slot while it's being overwritten. A reader that falls
+//              more than the whole buffer behind loses the overwritten values, which it can tell
+//              from the push count.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+template <class T, size_t CAPACITY>
+class RingBuffer
+{
+public:
+	static_assert((CAPACITY & (CAPACITY - 1u)) == 0u, "The capacity must be a power of two");
+
+	void push(const T& value)
+	{
+		slots[pushCount & (CAPACITY - 1u)] = value;
+		++pushCount;
+	}
+
+	// Total number of values pushed so far, including the ones that have been overwritten
+	std::uint64_t getPushCount() const { return pushCount; }
+	size_t getSize() const { return static_cast<size_t>(std::min<std::uint64_t>(getPushCount(), CAPACITY)); }
+
+	// Value pushed as number `index` (counted from 0), which must still be in the buffer
+	const T& get(std::uint64_t index) const { return slots[index & (CAPACITY - 1u)]; }
+	// The value pushed `age` values ago, 0 being the latest, for age < getSize()
+	const T& getLatest(size_t age = 0u) const { return get(getPushCount() - 1u - age); }
+
+private:
+	std::array<T, CAPACITY> slots{};
+	std::uint64_t pushCount = 0u;
+};
\ No newline at end of file
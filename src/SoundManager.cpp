@@ -14,79 +14,162 @@
 
 using namespace Utility;
 
-void SoundManager::loadSounds()
+namespace
 {
-	auto load = [&](SoundID soundID, const std::string& filename)
-		{
-			soundBuffers[soundID] = std::make_shared<sf::SoundBuffer>(filename);
-		};
-
-	load(SoundID::GAME_START, "assets/sounds/448262__henryrichard__sfx-begin-2.wav");
-	load(SoundID::COLLISION, "assets/sounds/321805__lloydevans09__pvc_pipe_hit_1.wav");
-	load(SoundID::LINE_CLEAR, "assets/sounds/109662__grunz__success.wav");
-	load(SoundID::LEVEL_UP, "assets/sounds/439889__simonbay__lushlife_levelup.wav");
-	load(SoundID::PAUSE, "assets/sounds/459344__lilmati__select-granted-03.wav");
-	load(SoundID::GAME_OVER, "assets/sounds/382310__mountain_man__game-over-arcade.wav");
+	struct SoundSettings
+	{
+		const char* name; // In the asset archive
+		unsigned maxVoices; // Voices the sound can play on at once, a new one restarts the oldest
+		int priority; // Sounds of a higher priority take voices from lower ones when none are free
+	};
+
+	constexpr std::array<SoundSettings, static_cast<size_t>(SoundManager::SoundID::COUNT)> SOUND_SETTINGS =
+	{{
+		{ "sounds/448262__henryrichard__sfx-begin-2.wav", 1u, 3 },    // GAME_START
+		{ "sounds/321805__lloydevans09__pvc_pipe_hit_1.wav", 3u, 0 }, // COLLISION
+		{ "sounds/109662__grunz__success.wav", 2u, 2 },               // LINE_CLEAR
+		{ "sounds/439889__simonbay__lushlife_levelup.wav", 1u, 2 },   // LEVEL_UP
+		{ "sounds/459344__lilmati__select-granted-03.wav", 2u, 1 },   // PAUSE
+		{ "sounds/382310__mountain_man__game-over-arcade.wav", 1u, 3 }// GAME_OVER
+	}};
+
+	const SoundSettings& getSettings(SoundManager::SoundID soundID)
+	{
+		return SOUND_SETTINGS[static_cast<size_t>(soundID)];
+	}
 }
 
-void SoundManager::playSound(SoundID soundID, float pitchVariancePercentage, float basePitch, float volumeMultiplier)
+SoundManager::SoundManager(const AssetArchive& assets) :
+	isLoadingFinished(false),
+	startCount(0u)
 {
-	auto it = soundBuffers.find(soundID);
-	if (it != soundBuffers.end())
-	{
-		auto sound = std::make_shared<sf::Sound>(*it->second);
+	loadSounds(assets);
+}
 
-		if (pitchVariancePercentage < 0.f || pitchVariancePercentage > 1.f) {
-			std::cerr << "Warning: Pitch variance percentage must be between 0 and 1! Pitch variance set to default (0%)" << std::endl;
-			pitchVariancePercentage = 0.f;
-		}
-		if (pitchVariancePercentage != 0.f)
-			sound->setPitch(Utility::randomPitch(pitchVariancePercentage, basePitch));
+void SoundManager::loadSounds(const AssetArchive& assets)
+{
+	for (size_t i = 0; i < SOUND_COUNT; ++i)
+	{
+		loading[i] = std::async(std::launch::async, [this, i, sound = assets.find(SOUND_SETTINGS[i].name)]
+			{
+				return sound.data && soundBuffers[i].loadFromMemory(sound.data, sound.size);
+			});
+	}
+}
 
-		sound->setVolume(volume * volumeMultiplier);
-		sound->play();
+bool SoundManager::isLoaded()
+{
+	if (isLoadingFinished)
+		return true;
 
-		activeSounds.push_back(sound);
+	for (const auto& future : loading)
+	{
+		if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return false;
 	}
-	else
+	for (size_t i = 0; i < SOUND_COUNT; ++i)
 	{
-		std::cerr << "Error: Sound ID not found!" << std::endl;
+		if (!loading[i].get())
+			std::cerr << "Error: Failed to load the sound " << SOUND_SETTINGS[i].name << " from the asset archive." << std::endl;
+	}
+
+	// The voices attach themselves to a buffer, which the workers must be done with by then
+	voices.reserve(VOICE_COUNT);
+	for (size_t i = 0; i < VOICE_COUNT; ++i)
+		voices.push_back({ sf::Sound(soundBuffers.front()), SoundID::GAME_START, 0u });
+	isLoadingFinished = true;
+	return true;
+}
+
+void SoundManager::playSound(SoundID soundID, float pitchVariancePercentage, float basePitch, float volumeMultiplier)
+{
+	if (pitchVariancePercentage < 0.f || pitchVariancePercentage > 1.f) {
+		std::cerr << "Warning: Pitch variance percentage must be between 0 and 1! Pitch variance set to default (0%)" << std::endl;
+		pitchVariancePercentage = 0.f;
 	}
+
+	sf::Sound* sound = acquireVoice(soundID);
+	if (!sound)
+		return;
+
+	sound->setPitch(pitchVariancePercentage != 0.f ? Utility::randomPitch(pitchVariancePercentage, basePitch) : 1.f);
+	sound->setVolume(volume * volumeMultiplier);
+	sound->play();
 }
 
 void SoundManager::playSoundAtPitch(SoundID soundID, float pitch, float volumeMultiplier)
 {
-	auto it = soundBuffers.find(soundID);
-	if (it != soundBuffers.end())
-	{
-		auto sound = std::make_shared<sf::Sound>(*it->second);
+	sf::Sound* sound = acquireVoice(soundID);
+	if (!sound)
+		return;
 
-		sound->setPitch(pitch);
-		sound->setVolume(volume * volumeMultiplier);
-		sound->play();
+	sound->setPitch(pitch);
+	sound->setVolume(volume * volumeMultiplier);
+	sound->play();
+}
 
-		activeSounds.push_back(sound);
-	}
-	else
+size_t SoundManager::getPlayingVoiceCount() const
+{
+	return static_cast<size_t>(std::count_if(voices.begin(), voices.end(), [](const Voice& voice)
+		{
+			return voice.sound.getStatus() != sf::Sound::Status::Stopped;
+		}));
+}
+
+sf::Sound* SoundManager::acquireVoice(SoundID soundID)
+{
+	if (soundID == SoundID::COUNT)
 	{
 		std::cerr << "Error: Sound ID not found!" << std::endl;
+		return nullptr;
 	}
-}
+	if (!isLoaded())
+		return nullptr;
 
-void SoundManager::cleanupSounds(float fixedTimeStep, float interval)
-{
-	static float timeSinceLastCleanup = 0.f;
-	timeSinceLastCleanup += fixedTimeStep;
+	const SoundSettings& settings = getSettings(soundID);
+	Voice* free = nullptr;
+	Voice* oldestSame = nullptr; // Oldest voice playing the same sound
+	Voice* victim = nullptr; // Oldest voice playing a sound of the lowest priority
+	unsigned sameCount = 0u;
 
-	if (timeSinceLastCleanup >= interval)
+	// A single pass over the pool finds everything the decision needs
+	for (Voice& voice : voices)
 	{
-		timeSinceLastCleanup = 0.f;
-
-		activeSounds.erase(
-			std::remove_if(activeSounds.begin(), activeSounds.end(),
-				[](const std::shared_ptr<sf::Sound>& sound) {
-					return sound->getStatus() == sf::Sound::Status::Stopped;
-				}),
-			activeSounds.end());
+		if (voice.sound.getStatus() == sf::Sound::Status::Stopped)
+		{
+			if (!free)
+				free = &voice;
+			continue;
+		}
+
+		if (voice.soundID == soundID)
+		{
+			++sameCount;
+			if (!oldestSame || voice.startOrder < oldestSame->startOrder)
+				oldestSame = &voice;
+		}
+
+		const int priority = getSettings(voice.soundID).priority;
+		const int victimPriority = victim ? getSettings(victim->soundID).priority : 0;
+		if (!victim || priority < victimPriority || (priority == victimPriority && voice.startOrder < victim->startOrder))
+			victim = &voice;
 	}
+
+	Voice* voice = nullptr;
+	if (sameCount >= settings.maxVoices)
+		voice = oldestSame;
+	else if (free)
+		voice = free;
+	else if (victim && getSettings(victim->soundID).priority <= settings.priority)
+		voice = victim;
+	else
+		return nullptr;
+
+	// Changing the buffer stops whatever the voice was playing
+	voice->sound.stop();
+	if (voice->soundID != soundID)
+		voice->sound.setBuffer(soundBuffers[static_cast<size_t>(soundID)]);
+	voice->soundID = soundID;
+	voice->startOrder = ++startCount;
+	return &voice->sound;
 }
\ No newline at end of file
@@ -3,6 +3,12 @@
 // Author: Luka Vukorepa (https://github.com/lukav1607)
 // Created: May 10, 2025
 // Description: Defines the SoundManager class, which is responsible for managing sound effects in the game.
+//              Sounds play on a fixed pool of voices created up front: a voice is reused as soon as
+//              its sound has finished, every sound has a limit on how many voices it can hold at once,
+//              and when no voice is free the new sound takes over the oldest one of the lowest priority,
+//              if that is not above its own. Playing a sound never allocates and does the same bounded
+//              amount of work however fast the game goes. The sounds are decoded in parallel on
+//              worker threads while the game starts up; sounds played before they are ready are skipped.
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
@@ -10,14 +16,19 @@
 
 #pragma once
 
-#include <memory>
-#include <unordered_map>
+#include <array>
+#include <future>
+#include <vector>
 #include <SFML/Audio.hpp>
+#include "AssetArchive.hpp"
 
 class SoundManager
 {
 public:
-	SoundManager() { loadSounds(); }
+	static constexpr size_t VOICE_COUNT = 8u;
+
+	// The sounds are decoded from the archive, which has to stay open until they are loaded
+	explicit SoundManager(const AssetArchive& assets);
 	SoundManager(const SoundManager&) = delete;
 	SoundManager& operator=(const SoundManager&) = delete;
 
@@ -28,13 +39,12 @@ public:
 		LINE_CLEAR,
 		LEVEL_UP,
 		PAUSE,
-		GAME_OVER
+		GAME_OVER,
+		COUNT
 	};
 
-	void loadSounds();
-
-	// Removes any sounds that are no longer playing every `interval` seconds 
-	void cleanupSounds(float fixedTimeStep, float interval);
+	// True once every sound is decoded, without waiting for them
+	bool isLoaded();
 
 	// Play a sound at specified volume with a random pitch variation offset from `basePitch`
 	// Note: pitchVariancePercentage 0.15f == +/- 15% variation
@@ -43,9 +53,29 @@ public:
 	// Play a sound at specified volume with specified pitch.
 	void playSoundAtPitch(SoundID soundID, float pitch, float volumeMultiplier = 1.f);
 
+	// Number of voices that are playing a sound
+	size_t getPlayingVoiceCount() const;
+
 	float volume = 100.f;
 
 private:
-	std::unordered_map<SoundID, std::shared_ptr<sf::SoundBuffer>> soundBuffers;
-	std::vector<std::shared_ptr<sf::Sound>> activeSounds;
+	static constexpr size_t SOUND_COUNT = static_cast<size_t>(SoundID::COUNT);
+
+	struct Voice
+	{
+		sf::Sound sound;
+		SoundID soundID;
+		unsigned long long startOrder; // When the sound started, to find the oldest one
+	};
+
+	// Start decoding every sound on a worker thread of its own
+	void loadSounds(const AssetArchive& assets);
+	// Voice to play the sound on, or nullptr if every voice it could take plays something more important
+	sf::Sound* acquireVoice(SoundID soundID);
+
+	std::array<sf::SoundBuffer, SOUND_COUNT> soundBuffers; // Owned by the workers until they finish
+	std::array<std::future<bool>, SOUND_COUNT> loading;
+	bool isLoadingFinished;
+	std::vector<Voice> voices; // Created once the sounds are loaded, never resized
+	unsigned long long startCount;
 };
\ No newline at end of file
@@ -7,12 +7,15 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <iostream>
 #include "TitleScreenShapes.hpp"
+#include "RenderStats.hpp"
 #include "Game.hpp"
 
-TitleScreenShapes::TitleScreenShapes()
+TitleScreenShapes::TitleScreenShapes() :
+	isBackdropCached(false)
 {
-	float size = 100.f;
+	const float size = SIZE;
 
 	shapes.fill(sf::RectangleShape(sf::Vector2f(size, size)));
 	for (auto& shape : shapes)
@@ -83,12 +86,42 @@ TitleScreenShapes::TitleScreenShapes()
 	shapes[1].setFillColor(sf::Color(255, 160, 0));
 	shapes[0].setPosition(offset + sf::Vector2f(size * 7, -size * 3));
 	shapes[0].setFillColor(sf::Color(255, 160, 0));
+
+	isBackdropCached = cacheBackdrop();
 }
 
 void TitleScreenShapes::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+	if (isBackdropCached)
+	{
+		sf::Sprite sprite(backdrop.getTexture());
+		sprite.setPosition({ 0.f, Game::WINDOW_HEIGHT - ROWS * SIZE });
+		target.draw(sprite, states);
+		RenderStats::countDrawCall();
+		return;
+	}
+
 	for (const auto& shape : shapes)
 	{
 		target.draw(shape, states);
+		RenderStats::countDrawCall();
 	}
+}
+
+bool TitleScreenShapes::cacheBackdrop()
+{
+	const sf::Vector2f backdropSize(static_cast<float>(Game::WINDOW_WIDTH), ROWS * SIZE);
+	if (!backdrop.resize(sf::Vector2u(backdropSize)))
+	{
+		std::cerr << "Error: Failed to create the title screen backdrop texture." << std::endl;
+		return false;
+	}
+
+	// The texture starts transparent, so the gaps between the shapes still show the background
+	backdrop.clear(sf::Color::Transparent);
+	backdrop.setView(sf::View(sf::FloatRect({ 0.f, Game::WINDOW_HEIGHT - backdropSize.y }, backdropSize)));
+	for (const auto& shape : shapes)
+		backdrop.draw(shape);
+	backdrop.display();
+	return true;
 }
\ No newline at end of file
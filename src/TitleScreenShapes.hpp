@@ -3,7 +3,8 @@
 // Author: Luka Vukorepa (https://github.com/lukav1607)
 // Created: May 10, 2025
 // Description: Defines the TitleScreenShapes class, which is responsible for creating and managing the
-//              shapes displayed on the title screen of the game.
+//              shapes displayed on the title screen of the game. The shapes never move, so they are
+//              rendered once into a texture and drawn as a single sprite afterwards.
 // ================================================================================================
 // License: MIT License
 // Copyright (c) 2025 Luka Vukorepa
@@ -20,5 +21,13 @@ public:
 	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 private:
+	static constexpr float SIZE = 100.f;
+	static constexpr unsigned ROWS = 4u;
+
+	// Render the shapes into the backdrop texture, which covers the bottom rows of the window
+	bool cacheBackdrop();
+
 	std::array<sf::RectangleShape, 24> shapes;
+	sf::RenderTexture backdrop;
+	bool isBackdropCached; // The shapes are drawn one by one if the texture couldn't be created
 };
\ No newline at end of file
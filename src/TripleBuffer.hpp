@@ -0,0 +1,57 @@
+// ================================================================================================
+// File: TripleBuffer.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the TripleBuffer class, which hands the latest value from one writer thread
+//              to one reader thread without either of them ever waiting for the other. There are
+//              three slots: the writer fills its back slot and swaps it with the middle one, and the
+//              reader swaps its front slot with the middle one when there is something new in it.
+//              The swaps are single atomic exchanges of the middle index, which carries a flag for
+//              whether it was written since the reader last took it. Values the reader doesn't get
+//              to before the next one is published are skipped, so it always sees the newest one.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+template <class T>
+class TripleBuffer
+{
+public:
+	// Slot the writer fills, which no reader can see until it's published
+	T& getWriteBuffer() { return slots[backIndex]; }
+
+	// Make the write buffer the latest value, and get the slot of the next one
+	void publish()
+	{
+		backIndex = middle.exchange(backIndex | NEW_FLAG, std::memory_order_acq_rel) & INDEX_MASK;
+	}
+
+	// Take the latest value if there is a new one since the last call, returning true if there was
+	bool update()
+	{
+		if ((middle.load(std::memory_order_relaxed) & NEW_FLAG) == 0u)
+			return false;
+
+		frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX_MASK;
+		return true;
+	}
+
+	// Latest value taken by update(), which stays the same until the next one is taken
+	const T& getReadBuffer() const { return slots[frontIndex]; }
+
+private:
+	static constexpr std::uint8_t INDEX_MASK = 0x3u;
+	static constexpr std::uint8_t NEW_FLAG = 0x4u;
+
+	std::array<T, 3> slots{};
+	std::uint8_t backIndex = 0u; // Only used by the writer
+	std::uint8_t frontIndex = 1u; // Only used by the reader
+	std::atomic<std::uint8_t> middle{ 2u };
+};
\ No newline at end of file
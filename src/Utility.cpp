@@ -7,21 +7,9 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
-#include <map>
 #include <random>
 #include "Utility.hpp"
 
-bool Utility::isKeyReleased(sf::Keyboard::Key key)
-{
-	static std::map<sf::Keyboard::Key, bool> keyStates;
-	if (keyStates.find(key) == keyStates.end())
-		keyStates[key] = false;
-	bool isPressedNow = sf::Keyboard::isKeyPressed(key);
-	bool wasPressedLastFrame = keyStates[key];
-	keyStates[key] = isPressedNow;
-	return !isPressedNow && wasPressedLastFrame;
-}
-
 sf::Color Utility::lerpColor(const sf::Color& a, const sf::Color& b, float t)
 {
 	return sf::Color(
@@ -10,12 +10,10 @@
 
 #pragma once
 
-#include <SFML/Window/Keyboard.hpp>
 #include <SFML/Graphics/Color.hpp>
 
 namespace Utility
 {
-	bool isKeyReleased(sf::Keyboard::Key key);
 	sf::Color lerpColor(const sf::Color& a, const sf::Color& b, float t);
 	// Generates a random pitch value based on a given variation percentage.
 	// Example use: variationPercent 0.15f == 15% variation
@@ -0,0 +1,123 @@
+// ================================================================================================
+// File: VertexLayer.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <iostream>
+#include "VertexLayer.hpp"
+#include "RenderStats.hpp"
+
+VertexLayer::VertexLayer(sf::VertexBuffer::Usage usage) :
+	vertexBuffer(sf::PrimitiveType::Triangles, usage),
+	usage(usage),
+	isVertexBufferUsed(true),
+	dirtyBegin(std::numeric_limits<size_t>::max()),
+	dirtyEnd(0u)
+{
+}
+
+void VertexLayer::resize(size_t vertexCount)
+{
+	vertices.assign(vertexCount, sf::Vertex());
+	vertexBuffer = sf::VertexBuffer(sf::PrimitiveType::Triangles, usage);
+	markDirty(0u, vertexCount);
+}
+
+void VertexLayer::writeQuad(size_t first, sf::Vector2f position, sf::Vector2f size, sf::Color color)
+{
+	const sf::Vector2f topRight(position.x + size.x, position.y);
+	const sf::Vector2f bottomLeft(position.x, position.y + size.y);
+	const sf::Vector2f bottomRight(position.x + size.x, position.y + size.y);
+
+	vertices[first + 0].position = position;
+	vertices[first + 1].position = topRight;
+	vertices[first + 2].position = bottomLeft;
+	vertices[first + 3].position = bottomLeft;
+	vertices[first + 4].position = topRight;
+	vertices[first + 5].position = bottomRight;
+	writeQuadColor(first, color);
+}
+
+void VertexLayer::writeQuadColor(size_t first, sf::Color color)
+{
+	for (size_t i = first; i < first + VERTICES_PER_QUAD; ++i)
+		vertices[i].color = color;
+
+	markDirty(first, VERTICES_PER_QUAD);
+}
+
+void VertexLayer::writeTexturedQuad(size_t first, sf::FloatRect rect, sf::FloatRect textureRect, sf::Color color)
+{
+	writeQuad(first, rect.position, rect.size, color);
+
+	const sf::Vector2f topLeft = textureRect.position;
+	const sf::Vector2f bottomRight = textureRect.position + textureRect.size;
+
+	vertices[first + 0].texCoords = topLeft;
+	vertices[first + 1].texCoords = { bottomRight.x, topLeft.y };
+	vertices[first + 2].texCoords = { topLeft.x, bottomRight.y };
+	vertices[first + 3].texCoords = { topLeft.x, bottomRight.y };
+	vertices[first + 4].texCoords = { bottomRight.x, topLeft.y };
+	vertices[first + 5].texCoords = bottomRight;
+}
+
+void VertexLayer::writeFrame(size_t first, sf::Vector2f position, sf::Vector2f size, float thickness, sf::Color color)
+{
+	// Same geometry as the outline of an sf::RectangleShape: the top and bottom edges cover the corners
+	writeQuad(first, { position.x - thickness, position.y - thickness }, { size.x + 2.f * thickness, thickness }, color);
+	writeQuad(first + VERTICES_PER_QUAD, { position.x - thickness, position.y + size.y }, { size.x + 2.f * thickness, thickness }, color);
+	writeQuad(first + 2u * VERTICES_PER_QUAD, { position.x - thickness, position.y }, { thickness, size.y }, color);
+	writeQuad(first + 3u * VERTICES_PER_QUAD, { position.x + size.x, position.y }, { thickness, size.y }, color);
+}
+
+void VertexLayer::upload()
+{
+	if (!isVertexBufferUsed || dirtyBegin >= dirtyEnd)
+		return;
+
+	// The buffer is created on first use, as it needs an OpenGL context
+	if (vertexBuffer.getVertexCount() != vertices.size())
+	{
+		if (!sf::VertexBuffer::isAvailable() || !vertexBuffer.create(vertices.size()) || !vertexBuffer.update(vertices.data()))
+		{
+			std::cerr << "Error: Failed to create a vertex buffer, drawing from memory instead." << std::endl;
+			vertexBuffer = sf::VertexBuffer(sf::PrimitiveType::Triangles, usage);
+			isVertexBufferUsed = false;
+		}
+	}
+	else
+	{
+		vertexBuffer.update(vertices.data() + dirtyBegin, dirtyEnd - dirtyBegin, static_cast<unsigned>(dirtyBegin));
+	}
+
+	dirtyBegin = std::numeric_limits<size_t>::max();
+	dirtyEnd = 0u;
+}
+
+void VertexLayer::draw(sf::RenderTarget& target, sf::RenderStates states, size_t first, size_t count) const
+{
+	if (count == 0u || first + count > vertices.size())
+		return;
+
+	if (isVertexBufferUsed && vertexBuffer.getVertexCount() == vertices.size())
+		target.draw(vertexBuffer, first, count, states);
+	else
+		target.draw(vertices.data() + first, count, sf::PrimitiveType::Triangles, states);
+	RenderStats::countDrawCall();
+}
+
+void VertexLayer::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	draw(target, states, 0u, vertices.size());
+}
+
+void VertexLayer::markDirty(size_t first, size_t count)
+{
+	dirtyBegin = std::min(dirtyBegin, first);
+	dirtyEnd = std::max(dirtyEnd, first + count);
+}
\ No newline at end of file
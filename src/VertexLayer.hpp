@@ -0,0 +1,58 @@
+// ================================================================================================
+// File: VertexLayer.hpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Defines the VertexLayer class, a list of triangles kept in memory and mirrored in an
+//              sf::VertexBuffer. Quads are written in place, and only the range of vertices written
+//              since the last upload is sent to the GPU. Static layers are uploaded once and drawn
+//              from the buffer every frame afterwards. When vertex buffers are not supported, the
+//              layer is drawn from memory instead.
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#pragma once
+
+#include <limits>
+#include <vector>
+#include <SFML/Graphics.hpp>
+
+class VertexLayer : public sf::Drawable
+{
+public:
+	static constexpr size_t VERTICES_PER_QUAD = 6u; // Two triangles
+	static constexpr size_t VERTICES_PER_FRAME = 4u * VERTICES_PER_QUAD;
+
+	explicit VertexLayer(sf::VertexBuffer::Usage usage);
+
+	// Resize the layer, which discards the vertex buffer and uploads everything on the next upload
+	void resize(size_t vertexCount);
+	size_t getVertexCount() const { return vertices.size(); }
+
+	void writeQuad(size_t first, sf::Vector2f position, sf::Vector2f size, sf::Color color);
+	void writeQuadColor(size_t first, sf::Color color);
+	// Write a quad mapped to a rectangle of the texture it is drawn with, in pixels
+	void writeTexturedQuad(size_t first, sf::FloatRect rect, sf::FloatRect textureRect, sf::Color color);
+	// Write an outline of the given thickness around the outside of a rectangle
+	void writeFrame(size_t first, sf::Vector2f position, sf::Vector2f size, float thickness, sf::Color color);
+
+	// Upload the vertices written since the last upload to the vertex buffer
+	void upload();
+
+	// Draw a range of the layer, counting it as one draw call
+	void draw(sf::RenderTarget& target, sf::RenderStates states, size_t first, size_t count) const;
+	void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+	void markDirty(size_t first, size_t count);
+
+	std::vector<sf::Vertex> vertices;
+	sf::VertexBuffer vertexBuffer;
+	sf::VertexBuffer::Usage usage;
+	bool isVertexBufferUsed;
+
+	// Range of vertices written since the last upload
+	size_t dirtyBegin;
+	size_t dirtyEnd;
+};
\ No newline at end of file
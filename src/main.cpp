@@ -8,11 +8,70 @@
 // Copyright (c) 2025 Luka Vukorepa
 // ================================================================================================
 
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string_view>
 #include "Game.hpp"
 
-int main()
+int main(int argc, char* argv[])
 {
-	std::unique_ptr<Game> game = std::make_unique<Game>();
+	const InputHandler::Clock::time_point startTime = InputHandler::Clock::now();
+	std::unique_ptr<Game> game = std::make_unique<Game>(startTime);
+
+	// Tetris --replay <file> plays a recorded game back instead of starting a new one, and --das and
+	// --arr set the auto-repeat timing of sideways movement in milliseconds. --latency-test <samples>
+	// measures the input-to-photon latency, e.g. along with --no-vsync or --tick-rate <hz>, and
+	// --startup-time measures the time to the first presented frame and quits. --practice lets games
+	// be rewound by holding Backspace.
+	std::chrono::milliseconds das = InputHandler::DEFAULT_DAS;
+	std::chrono::milliseconds arr = InputHandler::DEFAULT_ARR;
+	unsigned latencySamples = 0u;
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view argument(argv[i]);
+		const bool hasValue = i + 1 < argc;
+		if (argument == "--replay" && hasValue)
+		{
+			if (!game->loadReplay(argv[++i]))
+				return 1;
+		}
+		else if ((argument == "--das" || argument == "--arr") && hasValue)
+		{
+			const std::chrono::milliseconds value(std::strtoul(argv[++i], nullptr, 10));
+			(argument == "--das" ? das : arr) = value;
+		}
+		else if (argument == "--tick-rate" && hasValue)
+		{
+			game->setTickRate(static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10)));
+		}
+		else if (argument == "--latency-test" && hasValue)
+		{
+			latencySamples = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (argument == "--no-vsync")
+		{
+			game->setVerticalSyncEnabled(false);
+		}
+		else if (argument == "--startup-time")
+		{
+			game->showStartupTime();
+		}
+		else if (argument == "--practice")
+		{
+			game->setPracticeMode(true);
+		}
+		else
+		{
+			std::cerr << "Usage: " << argv[0] << " [--replay <file>] [--das <ms>] [--arr <ms>]"
+				<< " [--latency-test <samples>] [--no-vsync] [--tick-rate <hz>] [--startup-time] [--practice]" << std::endl;
+			return 1;
+		}
+	}
+	game->setRepeatTiming(das, arr);
+	if (latencySamples > 0u)
+		game->startLatencyTest(latencySamples);
+
 	game->run();
 	return 0;
 }
\ No newline at end of file
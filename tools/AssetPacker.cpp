@@ -0,0 +1,48 @@
+// ================================================================================================
+// File: AssetPacker.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Asset packer, run by the build to pack the fonts, sounds and music into the single
+//              archive the game maps at runtime. Every file is stored under its path relative to
+//              the asset directory, with forward slashes, e.g. "fonts/seguisb.ttf".
+//
+//              Usage: tetris-pack <archive> <asset directory> <file>...
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <iostream>
+#include "AssetArchive.hpp"
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cerr << "Usage: " << argv[0] << " <archive> <asset directory> <file>..." << std::endl;
+		return 1;
+	}
+
+	const std::filesystem::path root(argv[2]);
+	std::vector<std::pair<std::string, std::filesystem::path>> files;
+	for (int i = 3; i < argc; ++i)
+	{
+		const std::filesystem::path file(argv[i]);
+		const std::string name = file.lexically_relative(root).generic_string();
+		if (name.empty() || name.rfind("..", 0) == 0)
+		{
+			std::cerr << "Error: " << file.string() << " is not in the asset directory " << root.string() << "." << std::endl;
+			return 1;
+		}
+		files.emplace_back(name, file);
+	}
+	// The same files always make the same archive, whatever order they are listed in
+	std::sort(files.begin(), files.end());
+
+	if (!AssetArchive::pack(argv[1], files))
+		return 1;
+
+	std::cout << "Packed " << files.size() << " assets into " << argv[1] << std::endl;
+	return 0;
+}
\ No newline at end of file
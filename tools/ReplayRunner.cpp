@@ -0,0 +1,135 @@
+// ================================================================================================
+// File: ReplayRunner.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Headless replay runner. Plays a recorded game back as fast as possible, verifies
+//              that it reproduces the recorded result and final state exactly, and reports how
+//              fast the simulation ran, so a fixed set of replays can serve as a performance
+//              regression run. It can also record a game played by the bot, to create such replays
+//              without opening the game.
+//
+//              Usage: tetris-replay <replay> [--repeat N]
+//                     tetris-replay --record <replay> [--seed N] [--max-pieces N]
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "Core/AutoPlayer.hpp"
+#include "Core/Replay.hpp"
+
+namespace
+{
+	int printUsage(const char* program)
+	{
+		std::cerr << "Usage: " << program << " <replay> [--repeat N]\n"
+			<< "       " << program << " --record <replay> [--seed N] [--max-pieces N]" << std::endl;
+		return 1;
+	}
+
+	int record(const std::string& path, std::uint32_t seed, unsigned maxPieces)
+	{
+		Simulation simulation(seed);
+		AutoPlayer autoPlayer;
+		Replay replay;
+		replay.start(seed);
+
+		unsigned pieces = 0u;
+		while (!simulation.isGameOver() && pieces < maxPieces)
+		{
+			const Simulation::Input input = autoPlayer.update(simulation);
+			replay.record(input);
+			simulation.step(input);
+			if (simulation.hasEvent(Simulation::TETROMINO_LOCKED))
+				++pieces;
+		}
+		replay.finish(simulation);
+		if (!replay.saveToFile(path))
+			return 1;
+
+		std::printf("Recorded %u ticks, %u pieces, score %u, %u lines into %zu bytes of input\n",
+			replay.getTickCount(), pieces, replay.getScore(), replay.getLinesCleared(), replay.getInputSize());
+		return 0;
+	}
+
+	int play(const std::string& path, unsigned repeatCount)
+	{
+		Replay replay;
+		if (!replay.loadFromFile(path))
+			return 1;
+
+		std::printf("Replay: seed %u, %u ticks, score %u, %u lines, %zu bytes of input\n",
+			replay.getSeed(), replay.getTickCount(), replay.getScore(), replay.getLinesCleared(), replay.getInputSize());
+
+		double bestSeconds = 0.0;
+		for (unsigned repeat = 0; repeat < repeatCount; ++repeat)
+		{
+			Simulation simulation(replay.getSeed());
+			Replay::Player player(replay);
+
+			const auto start = std::chrono::steady_clock::now();
+			while (!player.isFinished())
+				simulation.step(player.next());
+			const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+			if (!replay.matches(simulation))
+			{
+				std::cerr << "Error: Playback diverged from the recording (score " << simulation.getScore()
+					<< ", " << simulation.getTotalLinesCleared() << " lines)." << std::endl;
+				return 1;
+			}
+			if (repeat == 0u || seconds < bestSeconds)
+				bestSeconds = seconds;
+		}
+
+		std::printf("Verified: playback matches the recording\n");
+		std::printf("Best of %u: %.3f ms, %.0f ticks/s (%.0fx real time)\n",
+			repeatCount,
+			bestSeconds * 1000.0,
+			replay.getTickCount() / bestSeconds,
+			replay.getTickCount() / bestSeconds / Simulation::TICKS_PER_SECOND);
+		return 0;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	std::string path;
+	bool isRecording = false;
+	unsigned repeatCount = 1u;
+	std::uint32_t seed = 1u;
+	unsigned maxPieces = 1000u;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string_view argument = argv[i];
+		const bool hasValue = i + 1 < argc;
+
+		if (argument == "--record" && hasValue)
+		{
+			isRecording = true;
+			path = argv[++i];
+		}
+		else if (argument == "--repeat" && hasValue)
+			repeatCount = std::max(1u, static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10)));
+		else if (argument == "--seed" && hasValue)
+			seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+		else if (argument == "--max-pieces" && hasValue)
+			maxPieces = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+		else if (path.empty() && argument.substr(0, 2) != "--")
+			path = argv[i];
+		else
+			return printUsage(argv[0]);
+	}
+	if (path.empty())
+		return printUsage(argv[0]);
+
+	return isRecording ? record(path, seed, maxPieces) : play(path, repeatCount);
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+// ================================================================================================
+// File: SelfPlay.cpp
+// Author: Luka Vukorepa (https://github.com/lukav1607)
+// Created: October 18, 2026
+// Description: Headless self-play harness. Plays a number of independent games as fast as possible
+//              on a pool of worker threads, each game with its own tetromino sequence and a placement
+//              policy that gives the input of every tick. The sequences are non-overlapping streams
+//              of a single seed, jumped apart before the games start. Reports the throughput of the
+//              engine (pieces, ticks and games per second), a histogram of the game lengths, and how
+//              the throughput scales from 1 to N threads. Every game only depends on its stream, so
+//              all thread counts play exactly the same games.
+//
+//              Usage: tetris-selfplay [--games N] [--threads N] [--max-pieces N] [--seed N]
+//                                     [--policy bot|random] [--no-scaling]
+// ================================================================================================
+// License: MIT License
+// Copyright (c) 2025 Luka Vukorepa
+// ================================================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "Core/AutoPlayer.hpp"
+
+namespace
+{
+	// Size of the block that is kept coherent between cores; data written by different workers is
+	// kept this far apart so the workers don't invalidate each other's caches
+	constexpr size_t CACHE_LINE_SIZE = 64u;
+	constexpr unsigned HISTOGRAM_BINS = 10u;
+	constexpr unsigned HISTOGRAM_BAR_WIDTH = 40u;
+
+	enum class PolicyType
+	{
+		Bot,   // AutoPlayer searching every placement to completion
+		Random // Random input every tick, a baseline that spends next to no time deciding
+	};
+
+	struct Options
+	{
+		unsigned games = 64u;
+		unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+		unsigned maxPieces = 500u; // Games that get this far are stopped, as the bot rarely tops out
+		std::uint32_t seed = 1u;
+		PolicyType policy = PolicyType::Bot;
+		bool isScalingMeasured = true;
+	};
+
+	// Decides the input of every tick of a game
+	class Policy
+	{
+	public:
+		virtual ~Policy() = default;
+		virtual Simulation::Input getInput(const Simulation& simulation) = 0;
+	};
+
+	class BotPolicy : public Policy
+	{
+	public:
+		Simulation::Input getInput(const Simulation& simulation) override { return autoPlayer.update(simulation); }
+
+	private:
+		AutoPlayer autoPlayer;
+	};
+
+	class RandomPolicy : public Policy
+	{
+	public:
+		explicit RandomPolicy(std::uint64_t seed) : rng(seed) {}
+
+		Simulation::Input getInput(const Simulation&) override
+		{
+			const std::uint32_t bits = rng();
+			Simulation::Input input;
+			input.shift = static_cast<std::int8_t>(((bits & 0x3u) == 0u ? -1 : 0) + ((bits & 0xCu) == 0u ? 1 : 0));
+			input.down = (bits & 0x30u) == 0u;
+			input.rotateCW = (bits & 0x1C0u) == 0u;
+			input.rotateCCW = (bits & 0xE00u) == 0u;
+			return input;
+		}
+
+	private:
+		Xoshiro128 rng;
+	};
+
+	std::unique_ptr<Policy> createPolicy(PolicyType type, std::uint64_t seed)
+	{
+		if (type == PolicyType::Random)
+			return std::make_unique<RandomPolicy>(seed);
+		return std::make_unique<BotPolicy>();
+	}
+
+	// Totals of the games played by a single worker, padded to its own cache lines
+	struct alignas(CACHE_LINE_SIZE) WorkerStats
+	{
+		unsigned long long ticks = 0u;
+		unsigned long long pieces = 0u;
+		unsigned long long linesCleared = 0u;
+		unsigned gamesLost = 0u;
+		std::vector<std::pair<unsigned, unsigned>> gameLengths; // (game, pieces), merged after the run
+	};
+
+	struct RunResult
+	{
+		double seconds = 0.0;
+		unsigned long long ticks = 0u;
+		unsigned long long pieces = 0u;
+		unsigned long long linesCleared = 0u;
+		unsigned gamesLost = 0u;
+		std::vector<unsigned> gameLengths; // Pieces placed in each game, in game order
+	};
+
+	void playGames(const Options& options, const std::vector<Xoshiro128>& streams, std::atomic<unsigned>& nextGame, WorkerStats& stats)
+	{
+		// The simulation and the policy are created on the worker's own thread, so their state is
+		// allocated apart from the other workers'
+		Simulation simulation(0u);
+
+		// Games are handed out one at a time, so workers that get shorter games take more of them
+		for (unsigned game = nextGame.fetch_add(1u, std::memory_order_relaxed); game < options.games;
+			game = nextGame.fetch_add(1u, std::memory_order_relaxed))
+		{
+			simulation.reset(streams[game]);
+			std::unique_ptr<Policy> policy = createPolicy(options.policy, (static_cast<std::uint64_t>(options.seed) << 32) | game);
+
+			// Counted locally and added once per game
+			unsigned long long ticks = 0u;
+			unsigned pieces = 0u;
+			while (!simulation.isGameOver() && pieces < options.maxPieces)
+			{
+				simulation.step(policy->getInput(simulation));
+				++ticks;
+				if (simulation.hasEvent(Simulation::TETROMINO_LOCKED))
+					++pieces;
+			}
+
+			stats.ticks += ticks;
+			stats.pieces += pieces;
+			stats.linesCleared += simulation.getTotalLinesCleared();
+			if (simulation.isGameOver())
+				++stats.gamesLost;
+			stats.gameLengths.emplace_back(game, pieces);
+		}
+	}
+
+	RunResult run(const Options& options, const std::vector<Xoshiro128>& streams, unsigned threadCount)
+	{
+		std::vector<WorkerStats> workerStats(threadCount);
+		alignas(CACHE_LINE_SIZE) std::atomic<unsigned> nextGame{ 0u };
+
+		const auto start = std::chrono::steady_clock::now();
+		std::vector<std::thread> workers;
+		workers.reserve(threadCount);
+		for (unsigned i = 0; i < threadCount; ++i)
+			workers.emplace_back(playGames, std::cref(options), std::cref(streams), std::ref(nextGame), std::ref(workerStats[i]));
+		for (std::thread& worker : workers)
+			worker.join();
+
+		RunResult result;
+		result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		result.gameLengths.resize(options.games);
+		for (const WorkerStats& stats : workerStats)
+		{
+			result.ticks += stats.ticks;
+			result.pieces += stats.pieces;
+			result.linesCleared += stats.linesCleared;
+			result.gamesLost += stats.gamesLost;
+			for (const auto& [game, pieces] : stats.gameLengths)
+				result.gameLengths[game] = pieces;
+		}
+		return result;
+	}
+
+	void printRun(unsigned threadCount, const RunResult& result, double singleThreadSeconds, unsigned games)
+	{
+		std::printf("%7u %9.3f %12.0f %12.0f %9.1f",
+			threadCount,
+			result.seconds,
+			result.pieces / result.seconds,
+			result.ticks / result.seconds,
+			games / result.seconds);
+
+		// Scaling is relative to the single thread run, if there was one
+		if (singleThreadSeconds > 0.0)
+		{
+			const double speedup = singleThreadSeconds / result.seconds;
+			std::printf(" %8.2fx %10.0f%%\n", speedup, 100.0 * speedup / threadCount);
+		}
+		else
+			std::printf(" %9s %11s\n", "-", "-");
+	}
+
+	void printHistogram(const std::vector<unsigned>& gameLengths)
+	{
+		if (gameLengths.empty())
+			return;
+
+		const unsigned longest = *std::max_element(gameLengths.begin(), gameLengths.end());
+		const unsigned binWidth = longest / HISTOGRAM_BINS + 1u;
+		std::vector<unsigned> bins(HISTOGRAM_BINS, 0u);
+		for (unsigned length : gameLengths)
+			++bins[length / binWidth];
+		const unsigned largestBin = *std::max_element(bins.begin(), bins.end());
+
+		std::printf("\nGame length (pieces):\n");
+		for (unsigned i = 0; i < HISTOGRAM_BINS; ++i)
+		{
+			const unsigned barLength = (bins[i] * HISTOGRAM_BAR_WIDTH + largestBin - 1u) / largestBin;
+			std::printf("  %6u - %-6u %6u  %s\n", i * binWidth, (i + 1u) * binWidth - 1u, bins[i], std::string(barLength, '#').c_str());
+		}
+	}
+
+	bool parseOptions(int argc, char* argv[], Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view argument = argv[i];
+			const bool hasValue = i + 1 < argc;
+
+			if (argument == "--no-scaling")
+				options.isScalingMeasured = false;
+			else if (argument == "--policy" && hasValue)
+			{
+				const std::string_view value = argv[++i];
+				if (value == "bot")
+					options.policy = PolicyType::Bot;
+				else if (value == "random")
+					options.policy = PolicyType::Random;
+				else
+					return false;
+			}
+			else if ((argument == "--games" || argument == "--threads" || argument == "--max-pieces" || argument == "--seed") && hasValue)
+			{
+				char* end = nullptr;
+				const unsigned long value = std::strtoul(argv[++i], &end, 10);
+				if (*end != '\0')
+					return false;
+
+				if (argument == "--games")
+					options.games = static_cast<unsigned>(value);
+				else if (argument == "--threads")
+					options.threads = std::max(1u, static_cast<unsigned>(value));
+				else if (argument == "--max-pieces")
+					options.maxPieces = static_cast<unsigned>(value);
+				else
+					options.seed = static_cast<std::uint32_t>(value);
+			}
+			else
+				return false;
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!parseOptions(argc, argv, options))
+	{
+		std::cerr << "Usage: " << argv[0] << " [--games N] [--threads N] [--max-pieces N] [--seed N] [--policy bot|random] [--no-scaling]" << std::endl;
+		return 1;
+	}
+
+	std::printf("Self-play: %u games, %s policy, at most %u pieces per game, seed %u\n\n",
+		options.games, options.policy == PolicyType::Bot ? "bot" : "random", options.maxPieces, options.seed);
+	std::printf("%7s %9s %12s %12s %9s %9s %11s\n", "Threads", "Time (s)", "Pieces/s", "Ticks/s", "Games/s", "Speedup", "Efficiency");
+
+	// Thread counts double from 1 up to the requested count
+	std::vector<unsigned> threadCounts;
+	if (options.isScalingMeasured)
+		for (unsigned threadCount = 1u; threadCount < options.threads; threadCount *= 2u)
+			threadCounts.push_back(threadCount);
+	threadCounts.push_back(options.threads);
+
+	// Every game gets its own stream, 2^64 numbers apart from the previous one
+	std::vector<Xoshiro128> streams;
+	streams.reserve(options.games);
+	Xoshiro128 rng(options.seed);
+	for (unsigned game = 0; game < options.games; ++game)
+	{
+		streams.push_back(rng);
+		rng.jump();
+	}
+
+	double singleThreadSeconds = 0.0;
+	RunResult firstResult;
+	RunResult result;
+	for (unsigned threadCount : threadCounts)
+	{
+		result = run(options, streams, threadCount);
+		if (threadCount == 1u)
+			singleThreadSeconds = result.seconds;
+		printRun(threadCount, result, singleThreadSeconds, options.games);
+
+		if (threadCount == threadCounts.front())
+			firstResult = result;
+		else if (result.gameLengths != firstResult.gameLengths || result.ticks != firstResult.ticks)
+			std::cerr << "Error: Games played with " << threadCount << " threads differ from the games played with " << threadCounts.front() << std::endl;
+	}
+
+	std::printf("\nPieces: %llu, ticks: %llu, lines cleared: %llu\n", result.pieces, result.ticks, result.linesCleared);
+	std::printf("Games lost: %u, stopped at %u pieces: %u\n", result.gamesLost, options.maxPieces, options.games - result.gamesLost);
+	if (options.games > 0u)
+		std::printf("Average game length: %.1f pieces\n", static_cast<double>(result.pieces) / options.games);
+	printHistogram(result.gameLengths);
+
+	return 0;
+}
\ No newline at end of file